@@ -94,7 +94,7 @@
 #endif
 #define	FIRMWARE_VERSION					"V1.1.0"
 #define	STRING_DISTRIBUTION_DATE	"2021-06-15"
-#define EEPROM_VERSION 			  		"V84"						//modify it if need auto inilize EEPROM after upload firmware
+#define EEPROM_VERSION 			  		"V85"						//modify it if need auto inilize EEPROM after upload firmware
 #define STRING_CONFIG_H_AUTHOR    "(ZONESTAR, Hally)" 		// Who made the changes.
 #define WEBSITE_URL 							"www.zonestar3d.com"
 //===========================================================================
@@ -410,6 +410,34 @@
   #if ENABLED(GRADIENT_MIX)
     #define GRADIENT_VTOOL       		// Add M166 T to use a V-tool index as a Gradient alias
   #endif
+
+  /**
+   * Purge only what a tool change needs. The chamber volume and the mix
+   * difference give the purge length, so a small change purges a little
+   * and an unchanged mix none at all. Set with M168.
+   *
+   * Patterns: 0 = Off
+   *           1 = Purge at a park point (e.g., over a bucket) and wipe in X
+   *           2 = Zigzag the purge into a tower. Needs a change on every layer.
+   *               A purge longer than the rows left on the layer is cut short.
+   */
+  //#define HOTEND_CLEAN_TOWER
+  #if ENABLED(HOTEND_CLEAN_TOWER)
+    #define CLEAN_TOWER_PATTERN          1  // Default pattern
+    #define CLEAN_TOWER_POS       { 5, 5 }  // (mm) Park point or tower corner
+    #define CLEAN_TOWER_LENGTH          20  // (mm) Wipe length or tower width
+    #define CLEAN_TOWER_VOLUME          40  // (mm³) Mixing chamber and nozzle volume
+    #define CLEAN_TOWER_TOLERANCE        3  // (%) Old mix left in the chamber after the purge
+    #define CLEAN_TOWER_FULL_PURGE      80  // (mm) Fixed purge it replaces, for the savings report
+    #define CLEAN_TOWER_FEEDRATE         4  // (mm/s) Purge at the park point
+    #define CLEAN_TOWER_LINE_WIDTH     0.5  // (mm) Tower lines
+    #define CLEAN_TOWER_LAYER_HEIGHT   0.2  // (mm)
+    #define CLEAN_TOWER_LINE_SPEED      30  // (mm/s)
+    #define CLEAN_TOWER_ZRAISE           2  // (mm) Raise for the travel moves
+    #define CLEAN_TOWER_TRAVEL_SPEED   120  // (mm/s)
+    #define CLEAN_TOWER_RETRACT          4  // (mm)
+    #define CLEAN_TOWER_RETRACT_SPEED   40  // (mm/s)
+  #endif
 #endif
 
 // Offset of the extruders (uncomment if using more than one and relying on firmware to position when changing).
@@ -796,6 +824,20 @@
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
 //#define ENDSTOP_INTERRUPTS_FEATURE
 
+/**
+ * Latch the step position at the endstop edge. The noise filter and polling
+ * delay the stop, so homing corrects for the distance run past the edge and
+ * probes report the edge position. With exact triggers HOMING_BUMP_DIVISOR
+ * can be lowered for a faster second bump. Axes with dual or multiple
+ * endstops home without the correction.
+ * Most exact with ENDSTOP_INTERRUPTS_FEATURE.
+ */
+//#define ENDSTOP_EDGE_CAPTURE
+
+// Skip endstop updates while endstops and probe are off. With
+// ENDSTOPS_ALWAYS_ON_DEFAULT disabled no endstop time is spent printing.
+//#define ENDSTOPS_POLL_ONLY_WHEN_ENABLED
+
 /**
  * Endstop Noise Threshold
  *
@@ -1125,6 +1167,30 @@
 //#define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Fast Mesh Probing
+ *
+ * Speed up G29 on a grid. Probing starts at the grid corner nearest the
+ * probe. The lift off each point is blended with the XY travel to the next,
+ * which ends just above the height of the previous touch, but never lower
+ * than FAST_MESH_MIN_CLEARANCE over the bed. Each point gets a fast touch
+ * and a slow touch. Timing for each phase is reported.
+ *
+ * With FAST_MESH_REUSE_TOUCH the fast touch is used alone once it has
+ * matched the slow touch on the first few points.
+ */
+//#define FAST_MESH_PROBING
+#if ENABLED(FAST_MESH_PROBING)
+  #define FAST_MESH_LIFT       2      // (mm) Lift above the last touch before traveling
+  #define FAST_MESH_APPROACH   1      // (mm) Height above the last touch where travel ends
+  #define FAST_MESH_MIN_CLEARANCE 0.5 // (mm) Lowest probe height over Z0 for the travel
+  //#define FAST_MESH_REUSE_TOUCH
+  #if ENABLED(FAST_MESH_REUSE_TOUCH)
+    #define FAST_MESH_REUSE_CHECKS    3     // Points probed both ways before reuse
+    #define FAST_MESH_REUSE_TOLERANCE 0.02  // (mm) Allowed spread of fast-slow difference
+  #endif
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1442,6 +1508,18 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Adaptive mesh. 'G29 A' probes a mesh over the area of the part being
+    // printed only and makes it the active mesh. The part bounds come from
+    // G29 L R F B or from the extruding moves of the open SD file.
+    //
+    //#define ADAPTIVE_MESH_PROBING
+    #if ENABLED(ADAPTIVE_MESH_PROBING)
+      #define ADAPTIVE_MESH_MARGIN  10  // (mm) Extra area probed around the part
+      #define ADAPTIVE_MESH_SPACING 20  // (mm) Largest distance between probe points
+      #define ADAPTIVE_MESH_SCAN_TIME 10 // (s) Longest scan of the SD file for the part bounds
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
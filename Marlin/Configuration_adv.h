@@ -379,6 +379,24 @@
   #define HOTEND_IDLE_BED_TARGET      0     // (°C) Safe temperature for the bed after timeout
 #endif
 
+/**
+ * Preheat Scheduler
+ * Overlap heat-up with homing and probing at the start of a job.
+ * M190 and M109 set their targets and return immediately, so G28 and G29
+ * run while the bed heats. During probing the hotend is held at a standby
+ * temperature. The waits are done before the first extruding move.
+ *
+ *   M116 S1 : Defer the following M190 / M109 waits
+ *   M116 S0 : Stop deferring
+ *   M116    : Wait for the deferred heaters now
+ */
+//#define PREHEAT_SCHEDULER
+#if ENABLED(PREHEAT_SCHEDULER)
+  #define PREHEAT_SCHEDULER_AUTO            // Defer automatically when an SD print starts
+  #define PREHEAT_PROBE_STANDBY_TEMP 150    // (°C) Hotend limit until the mesh is probed
+  //#define PREHEAT_PROBE_BED_WINDOW  10    // (°C) G29 waits for the bed to get this close to its target
+#endif
+
 // @section temperature
 
 // Calibration for AD595 / AD8495 sensor to adjust temperature measurements.
@@ -589,6 +607,11 @@
   #if ENABLED(Z_MULTI_ENDSTOPS)
     #define Z2_USE_ENDSTOP	   	   		PD1	//If use Z2_SW_PIN as Z2 ENDSTOP, enable this option
     #define Z2_ENDSTOP_ADJUSTMENT   	0
+    // Dual Z only: Stop each motor in the stepper ISR once its own endstop has
+    // read triggered for ENDSTOP_NOISE_THRESHOLD steps in a row, instead of at
+    // the next endstop poll. Homing keeps the fast and slow passes, and the Z2
+    // adjustment is still a back-off afterwards. M111 S32 reports the skew.
+    //#define Z_MULTI_HOMING_ISR_STOP
     #if NUM_Z_STEPPER_DRIVERS >= 3
       #define Z3_USE_ENDSTOP        	_YMAX_
       #define Z3_ENDSTOP_ADJUSTMENT 0
@@ -1153,6 +1176,10 @@
 // Show the E position (filament used) during printing
 //#define LCD_SHOW_E_TOTAL
 
+// Remember this many recent UTF-8 glyph lookups, and the widths of recently
+// measured menu strings. Speeds up menus in multibyte languages.
+//#define LCD_GLYPH_CACHE 32
+
 #if ENABLED(SHOW_BOOTSCREEN)
   #define BOOTSCREEN_TIMEOUT 4000        // (ms) Total Duration to display the boot screen(s)
 #endif
@@ -1270,6 +1297,28 @@
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
   #endif
 
+  /**
+   * Mount inserted media and count the files in the current folder a
+   * little at a time from the idle loop, so large cards and folders don't
+   * stall G-code processing. The count is kept until the folder changes,
+   * and sorting is put off until a sorted name is first needed.
+   */
+  //#define SD_BACKGROUND_SCAN
+  #if ENABLED(SD_BACKGROUND_SCAN)
+    #define SD_SCAN_SLICE_MS 2    // (ms) Time spent scanning per idle call
+  #endif
+
+  /**
+   * Read the highlighted print file from the idle loop while the file list
+   * is shown, for its layer count, estimated print time (planner limits),
+   * filament per mixing stepper and XY extents. The results are saved in a
+   * NAME.JOB file beside it. The DWIN remaining time and 'G29 A' use them.
+   */
+  //#define JOB_ANALYZER
+  #if ENABLED(JOB_ANALYZER)
+    #define JOB_ANALYZER_SLICE_MS 2 // (ms) Time spent reading per idle call
+  #endif
+
   // This allows hosts to request long names for files and folders with M33
   #define LONG_FILENAME_HOST_SUPPORT
 
@@ -1349,6 +1398,26 @@
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   #define BINARY_FILE_TRANSFER
 
+  /**
+   * Stage uploads (M28 and binary transfer) in RAM. Each full buffer is
+   * written as one pre-erased multi-block write per cluster, not one
+   * block at a time. Shows the upload rate on the DWIN Wi-Fi screen.
+   * For Wi-Fi uploads, raise the link speed with 'M575 P2 B921600'
+   * (BAUD_RATE_GCODE) and enlarge RX_BUFFER_SIZE.
+   * Not for USB flash drives or read-only cards.
+   */
+  //#define SD_UPLOAD_STREAM
+  #if ENABLED(SD_UPLOAD_STREAM)
+    #define SD_UPLOAD_BLOCKS 8    // Staging buffer in 512-byte blocks
+  #endif
+
+  /**
+   * With an SDIO-connected card (SDIO_SUPPORT) on STM32F1, fetch the next
+   * block by DMA while the current one is in use. Sequential reads, as in
+   * printing, no longer wait on the card. Costs 512 bytes of RAM.
+   */
+  //#define SDIO_READ_AHEAD
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -1368,6 +1437,14 @@
  */
 //#define NO_SD_HOST_DRIVE   // Disable SD Card access over USB (for security).
 
+/**
+ * Buffer USB mass-storage transfers to the onboard SD card (STM32F1 with
+ * USB_MASS_STORAGE). Reads also fetch the sectors that follow. Writes to
+ * consecutive sectors are held and written together, 200ms after the host
+ * goes quiet or on M21 / M22. M22 also reports the USB transfer rate.
+ */
+//#define USB_MSC_CACHE_SECTORS 16   // 512-byte sectors of RAM
+
 /**
  * Additional options for Graphical Displays
  *
@@ -1419,6 +1496,10 @@
     // The normal delay is 10µs. Use the lowest value that still gives a reliable display.
     //#define DOGM_SPI_DELAY_US 5
 
+    // Render the whole screen into a 1K framebuffer and send only the 16-pixel
+    // words that changed since the last frame. Costs 2K of RAM.
+    //#define ST7920_FRAMEBUFFER
+
     //#define LIGHTWEIGHT_UI
     #if ENABLED(LIGHTWEIGHT_UI)
       #define STATUS_EXPIRE_SECONDS 20
@@ -1572,6 +1653,10 @@
   // (recommended for smaller displays)
   //#define TOUCH_UI_PASSCODE
 
+  // Collect co-processor commands in RAM and send them in one SPI burst
+  // on execute(), instead of one transfer (plus a status read) per command.
+  //#define TOUCH_UI_CMD_BATCH_SIZE 256 // (bytes) Multiple of 4, up to 4092
+
   // Output extra debug info for Touch UI events
   //#define TOUCH_UI_DEBUG
 
@@ -1591,6 +1676,25 @@
   //#define TFT_BTOKMENU_COLOR 0x145F // 00010 100010 11111 Cyan
 #endif
 
+//
+// Color UI Options
+//
+#if ENABLED(TFT_COLOR_UI)
+  // Remember the rectangles drawn to the screen and skip a fill or canvas
+  // whose drawing commands match one that is still on screen. Status screen
+  // refreshes then only cost what actually changed.
+  //#define TFT_DIRTY_RECTS 32        // Number of rectangles to remember (12 bytes each)
+#endif
+
+//
+// LVGL UI Options
+//
+#if ENABLED(TFT_LVGL_UI)
+  // Keep recently decoded image data from the SPI Flash in RAM, so screens
+  // that were shown recently don't read and uncompress their icons again.
+  //#define SPI_FLASH_IMAGE_CACHE 16  // (KB) RAM for the cache, in 1KB blocks
+#endif
+
 //
 // ADC Button Debounce
 //
@@ -1614,6 +1718,16 @@
   //#define WATCHDOG_RESET_MANUAL
 #endif
 
+/**
+ * Deferred Boot
+ *
+ * Bring up only serial, settings, heaters and motion in setup() and skip the
+ * fixed one-second waits on each serial port. The display handshake and main
+ * menu, the first SD mount and the Wi-Fi module reset then run from idle()
+ * without blocking. Each stage reports its time, e.g. "Boot lcd: 930ms (at 1010ms)".
+ */
+//#define DEFERRED_BOOT
+
 // @section lcd
 
 /**
@@ -1675,6 +1789,9 @@
 #if ENABLED(LIN_ADVANCE)
   //#define EXTRA_LIN_ADVANCE_K // Enable for second linear advance constants
   #define LIN_ADVANCE_K 0.5     // Unit: mm compression per 1mm/s extruder speed
+  #if ENABLED(MIXING_EXTRUDER)
+    #define MIXING_ADVANCE_K 0.5  // K used when more than one mixing input is driven (M900 B)
+  #endif
   //#define LA_DEBUG            // If enabled, this will generate debug information output over USB.
   #define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve Acceleration
 #endif
@@ -1836,6 +1953,15 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  /**
+   * Print step jobs from SD. A step job holds precomputed pages, compressed with
+   * heatshrink (w8 l4), so the host doesn't have to stream them in real time.
+   * Make one from G-code with buildroot/share/scripts/stepjob.py, then print it
+   * like any other file. The job must match STEPPER_PAGE_FORMAT.
+   */
+  //#define DIRECT_STEPPING_SD
+#endif
 
 /**
  * G38 Probe Target
@@ -1923,6 +2049,19 @@
 #define MAX_CMD_SIZE 128
 #define BUFSIZE 4
 
+/**
+ * Packed Command Queue
+ * Store queued commands end-to-end in BUFSIZE * MAX_CMD_SIZE bytes instead of
+ * one MAX_CMD_SIZE slot each. A short move like "G1 X12.3 Y45.6 E0.0123" takes
+ * about 25 bytes, so many more commands can wait for the planner in the same RAM.
+ * A new command is accepted while there is room for a full MAX_CMD_SIZE line.
+ * With ADVANCED_OK the "ok" also reports the free bytes as F<int>.
+ */
+//#define PACKED_COMMAND_QUEUE
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define PACKED_QUEUE_SLOTS 20     // Most commands that can wait in the queue at once
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -3127,6 +3266,24 @@
  */
 #define AUTO_REPORT_TEMPERATURES
 
+/**
+ * Binary Telemetry
+ * Stream framed binary status records to a host with M156 S<hz> R<mask>.
+ * Each serial port (including the Wi-Fi port) has its own subscription.
+ * Records are built from a snapshot without float formatting and are only
+ * written when the TX buffer has room, so the main loop never blocks.
+ *
+ * Frame: A5 5A <version> <type> <seq> <len> <payload...> <CRC16 lo> <CRC16 hi>
+ * Multi-byte payload fields are little-endian. CRC16-CCITT covers version..payload.
+ */
+//#define BINARY_TELEMETRY
+#if ENABLED(BINARY_TELEMETRY)
+  #define TELEMETRY_MAX_RATE      50  // (Hz) Highest rate accepted by M156 S
+  #define TELEMETRY_BUFFER_SIZE  128  // (bytes) Per-port staging buffer. One sample must fit.
+  #define TELEMETRY_TX_CHUNK      64  // (bytes) Per-call limit for ports that can't report TX space,
+                                      // e.g., USB CDC on STM32F1, where a write may wait for the host
+#endif
+
 /**
  * Include capabilities in M115 output
  */
@@ -3202,6 +3359,14 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+
+  /**
+   * Convert G0-G3, G92, M104, M106, and M107 to binary records as they are
+   * queued, so they run without being parsed again. Letters and values are
+   * stored pre-converted. Other commands, and any line using features the
+   * record can't hold, stay as text.
+   */
+  //#define TOKENIZED_COMMANDS
 #endif
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
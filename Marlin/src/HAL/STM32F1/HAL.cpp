@@ -277,6 +277,9 @@ void HAL_idletask() {
     #ifdef USB_MASS_STORAGE
     // process USB mass storage device class loop
     MarlinMSC.loop();
+    #ifdef USB_MSC_CACHE_SECTORS
+      MSC_SD_idle();
+    #endif
 	#endif
   #endif
 }
@@ -23,6 +23,7 @@
 
 #include <HardwareSerial.h>
 #include <libmaple/usart.h>
+#include <libmaple/ring_buffer.h>
 #include <WString.h>
 
 #include "../../inc/MarlinConfigPre.h"
@@ -60,6 +61,12 @@ public:
       nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
     }
   #endif
+
+  // Free space in the TX ring buffer. write() waits when it's full.
+  int availableForWrite() {
+    ring_buffer * const wb = c_dev()->wb;
+    return wb->size - rb_full_count(wb);
+  }
 };
 
 extern MarlinSerial MSerial1;
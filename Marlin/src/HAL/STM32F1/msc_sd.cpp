@@ -27,14 +27,129 @@ MarlinUSBCompositeSerial MarlinCompositeSerial;
 
 #if SD_CONNECTION_IS(ONBOARD) && ENABLED(USB_MASS_STORAGE)
 
-  #include "onboard_sd.h"
+  #ifdef USB_MSC_CACHE_SECTORS
+    #define MSC_CARD_READ  MSC_ReadCard
+    #define MSC_CARD_WRITE MSC_WriteCard
+  #else
+    #define MSC_CARD_READ  MSC_Read
+    #define MSC_CARD_WRITE MSC_Write
+  #endif
 
-  static bool MSC_Write(const uint8_t *writebuff, uint32_t startSector, uint16_t numSectors) {
-    return (disk_write(0, writebuff, startSector, numSectors) == RES_OK);
-  }
-  static bool MSC_Read(uint8_t *readbuff, uint32_t startSector, uint16_t numSectors) {
-    return (disk_read(0, readbuff, startSector, numSectors) == RES_OK);
-  }
+  #if ENABLED(SDIO_SUPPORT)
+
+    #include "sdio.h"
+    #include "../../sd/Sd2Card_sdio.h"
+
+    // Whole USB transfers go to the card as SDIO multi-block DMA transfers
+    static bool MSC_CARD_WRITE(const uint8_t *writebuff, uint32_t startSector, uint16_t numSectors) {
+      return SDIO_WriteBlocks(startSector, writebuff, numSectors);
+    }
+    static bool MSC_CARD_READ(uint8_t *readbuff, uint32_t startSector, uint16_t numSectors) {
+      return SDIO_ReadBlocks(startSector, readbuff, numSectors);
+    }
+
+  #else
+
+    #include "onboard_sd.h"
+
+    static bool MSC_CARD_WRITE(const uint8_t *writebuff, uint32_t startSector, uint16_t numSectors) {
+      return (disk_write(0, writebuff, startSector, numSectors) == RES_OK);
+    }
+    static bool MSC_CARD_READ(uint8_t *readbuff, uint32_t startSector, uint16_t numSectors) {
+      return (disk_read(0, readbuff, startSector, numSectors) == RES_OK);
+    }
+
+  #endif
+
+  #ifdef USB_MSC_CACHE_SECTORS
+
+    #include "../../core/serial.h"
+
+    #define MSC_FLUSH_DELAY 200 // (ms) Write back this long after the host goes quiet
+
+    // Sectors around the last host access, either read ahead or waiting to be written
+    static uint32_t cache[USB_MSC_CACHE_SECTORS * 128];
+    static uint32_t cacheStart, cacheCount, cacheWriteMs, cardSectors;
+    static bool cacheDirty;
+
+    // Host traffic and the time spent serving it
+    static uint32_t bytesRead, bytesWritten, busyUs;
+
+    #define CACHE_DATA(S) ((uint8_t*)cache + 512U * ((S) - cacheStart))
+
+    static bool inCache(const uint32_t startSector, const uint16_t numSectors) {
+      return cacheCount && startSector < cacheStart + cacheCount && cacheStart < startSector + numSectors;
+    }
+
+    bool MSC_SD_flush() {
+      if (!cacheDirty) return true;
+      cacheDirty = false;
+      const bool ok = MSC_WriteCard((uint8_t*)cache, cacheStart, cacheCount);
+      cacheCount = 0;
+      return ok;
+    }
+
+    void MSC_SD_idle() {
+      if (cacheDirty && ELAPSED(millis(), cacheWriteMs + MSC_FLUSH_DELAY)) (void)MSC_SD_flush();
+    }
+
+    // Marlin wrote these sectors itself, so a read-ahead copy is stale
+    void MSC_SD_invalidate(const uint32_t startSector, const uint32_t numSectors) {
+      if (!cacheDirty && inCache(startSector, numSectors)) cacheCount = 0;
+    }
+
+    void MSC_SD_report() {
+      const uint32_t rate = busyUs ? uint32_t(uint64_t(bytesRead + bytesWritten) * 1000000U / 1024U / busyUs) : 0;
+      SERIAL_ECHOLNPAIR("USB read:", bytesRead >> 10, "K write:", bytesWritten >> 10, "K rate:", rate, "K/s");
+    }
+
+    // Serve a small read from the cache, filling it from the card with the following sectors
+    static bool MSC_Read(uint8_t *readbuff, uint32_t startSector, uint16_t numSectors) {
+      const uint32_t us = micros();
+      bool ok = true;
+      if (cacheCount && startSector >= cacheStart && startSector + numSectors <= cacheStart + cacheCount)
+        memcpy(readbuff, CACHE_DATA(startSector), 512U * numSectors);
+      else if (cacheDirty && inCache(startSector, numSectors) && !MSC_SD_flush())
+        ok = false;
+      else if (cacheDirty || numSectors >= USB_MSC_CACHE_SECTORS || startSector + USB_MSC_CACHE_SECTORS > cardSectors)
+        ok = MSC_ReadCard(readbuff, startSector, numSectors);
+      else {
+        cacheStart = startSector;
+        cacheCount = USB_MSC_CACHE_SECTORS;
+        ok = MSC_ReadCard((uint8_t*)cache, cacheStart, cacheCount);
+        if (ok) memcpy(readbuff, cache, 512U * numSectors); else cacheCount = 0;
+      }
+      if (ok) bytesRead += 512U * numSectors;
+      busyUs += micros() - us;
+      return ok;
+    }
+
+    // Collect consecutive (or repeated) sector writes, then write them to the card together
+    static bool MSC_Write(const uint8_t *writebuff, uint32_t startSector, uint16_t numSectors) {
+      const uint32_t us = micros();
+      bool ok = true;
+      if (!cacheDirty)
+        { if (inCache(startSector, numSectors)) cacheCount = 0; }
+      else if (startSector < cacheStart || startSector > cacheStart + cacheCount || startSector + numSectors > cacheStart + USB_MSC_CACHE_SECTORS)
+        ok = MSC_SD_flush();
+
+      if (ok) {
+        if (numSectors >= USB_MSC_CACHE_SECTORS)
+          ok = MSC_WriteCard(writebuff, startSector, numSectors);
+        else {
+          if (!cacheDirty) { cacheStart = startSector; cacheCount = 0; cacheDirty = true; }
+          memcpy(CACHE_DATA(startSector), writebuff, 512U * numSectors);
+          NOLESS(cacheCount, startSector + numSectors - cacheStart);
+          cacheWriteMs = millis();
+          if (cacheCount == USB_MSC_CACHE_SECTORS) ok = MSC_SD_flush();
+        }
+      }
+      if (ok) bytesWritten += 512U * numSectors;
+      busyUs += micros() - us;
+      return ok;
+    }
+
+  #endif // USB_MSC_CACHE_SECTORS
 
 #endif
 
@@ -58,10 +173,22 @@ void MSC_SD_init() {
   USBComposite.end();
   USBComposite.clear();
   // Set api and register mass storage
-  #if SD_CONNECTION_IS(ONBOARD) && ENABLED(USB_MASS_STORAGE)
+  #if SD_CONNECTION_IS(ONBOARD) && ENABLED(USB_MASS_STORAGE) && ENABLED(SDIO_SUPPORT)
+    // Share the card with Marlin's own SD init rather than resetting it again
+    if (SDIO_Begin()) {
+      #ifdef USB_MSC_CACHE_SECTORS
+        cardSectors = SdCard.LogBlockNbr;
+      #endif
+      MarlinMSC.setDriveData(0, SdCard.LogBlockNbr, MSC_Read, MSC_Write);
+      MarlinMSC.registerComponent();
+    }
+  #elif SD_CONNECTION_IS(ONBOARD) && ENABLED(USB_MASS_STORAGE)
     uint32_t cardSize;
     if (disk_initialize(0) == RES_OK) {
       if (disk_ioctl(0, GET_SECTOR_COUNT, (void *)(&cardSize)) == RES_OK) {
+        #ifdef USB_MSC_CACHE_SECTORS
+          cardSectors = cardSize;
+        #endif
         MarlinMSC.setDriveData(0, cardSize, MSC_Read, MSC_Write);
         MarlinMSC.registerComponent();
       }
@@ -40,6 +40,13 @@ public:
 extern USBMassStorage MarlinMSC;
 #endif
 
+#ifdef USB_MSC_CACHE_SECTORS
+  bool MSC_SD_flush();
+  void MSC_SD_idle();
+  void MSC_SD_invalidate(const uint32_t startSector, const uint32_t numSectors);
+  void MSC_SD_report();
+#endif
+
 extern MarlinUSBCompositeSerial MarlinCompositeSerial;
 
 void MSC_SD_init();
@@ -31,10 +31,19 @@
 #include "sdio.h"
 
 SDIO_CardInfoTypeDef SdCard;
+static bool cardReady; // = false
+
+#if ENABLED(SDIO_READ_AHEAD)
+  // The block after the last one read is fetched by DMA while the caller works on the last one
+  static uint32_t aheadBuffer[128];
+  static uint32_t aheadBlock;
+  static bool aheadPending, aheadValid;
+#endif
 
 bool SDIO_Init() {
   uint32_t count = 0U;
   SdCard.CardType = SdCard.CardVersion = SdCard.Class = SdCard.RelCardAdd = SdCard.BlockNbr = SdCard.BlockSize = SdCard.LogBlockNbr = SdCard.LogBlockSize = 0;
+  cardReady = false;
 
   sdio_begin();
   sdio_set_dbus_width(SDIO_CLKCR_WIDBUS_1BIT);
@@ -42,6 +51,7 @@ bool SDIO_Init() {
   dma_init(SDIO_DMA_DEV);
   dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_set_priority(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, DMA_PRIORITY_MEDIUM);
+  TERN_(SDIO_READ_AHEAD, aheadPending = aheadValid = false);
 
   if (!SDIO_CmdGoIdleState()) return false;
   if (!SDIO_CmdGoIdleState()) return false; /* Hotplugged cards tends to miss first CMD0, so give them a second chance. */
@@ -78,31 +88,45 @@ bool SDIO_Init() {
 
   sdio_set_dbus_width(SDIO_CLKCR_WIDBUS_4BIT);
   sdio_set_clock(SDIO_CLOCK);
-  return true;
+  return (cardReady = true);
+}
+
+// Keep the card an earlier SDIO_Init brought up while it still answers at its
+// address. A newly inserted card has no address yet, so it gets a full init.
+bool SDIO_Begin() {
+  return (cardReady && SDIO_GetCardState() == SDIO_CARD_TRANSFER) || SDIO_Init();
 }
 
-bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
+// Set up DMA and the data path, then send CMD17 / CMD18. The data arrives in the background.
+static bool SDIO_StartRead(uint32_t blockAddress, uint8_t *data, const uint16_t count) {
   if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return false;
-  if (blockAddress >= SdCard.LogBlockNbr) return false;
+  if (blockAddress + count > SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
 
   if (SdCard.CardType != CARD_SDHC_SDXC) { blockAddress *= 512U; }
 
   dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, data, DMA_SIZE_32BITS, DMA_MINC_MODE);
-  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128);
+  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128U * count);
   dma_clear_isr_bits(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_enable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
-  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
+  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U * count, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
 
-  if (!SDIO_CmdReadSingleBlock(blockAddress)) {
+  if (!(count > 1 ? SDIO_CmdReadMultBlock(blockAddress) : SDIO_CmdReadSingleBlock(blockAddress))) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS);
     dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
     return false;
   }
+  return true;
+}
 
+// Wait for a read started by SDIO_StartRead and check it
+static bool SDIO_FinishRead(const uint16_t count) {
   while (!SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) { /* wait */ }
 
+  // A multi-block read goes on until it's stopped
+  if (count > 1) (void)SDIO_CmdStopTransfer();
+
   //If there were SDIO errors, do not wait DMA.
   if (SDIO->STA & SDIO_STA_TRX_ERROR_FLAGS) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
@@ -135,51 +159,129 @@ bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
   return true;
 }
 
+bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data, const uint16_t count=1) {
+  return SDIO_StartRead(blockAddress, data, count) && SDIO_FinishRead(count);
+}
+
+#if ENABLED(SDIO_READ_AHEAD)
+
+  static void SDIO_ReadAheadStart(const uint32_t blockAddress) {
+    aheadValid = false;
+    if (blockAddress >= SdCard.LogBlockNbr) return;
+    aheadBlock = blockAddress;
+    aheadPending = SDIO_StartRead(blockAddress, (uint8_t*)aheadBuffer, 1);
+  }
+
+  // Let a pending read-ahead finish, since nothing else can use the bus before it does
+  static void SDIO_ReadAheadWait() {
+    if (aheadPending) {
+      aheadPending = false;
+      aheadValid = SDIO_FinishRead(1);
+    }
+  }
+
+  static void SDIO_ReadAheadDrop() { SDIO_ReadAheadWait(); aheadValid = false; }
+
+  // Copy the requested block from the read-ahead buffer, if it's there
+  static bool SDIO_ReadAheadTake(const uint32_t blockAddress, uint8_t *data) {
+    SDIO_ReadAheadWait();
+    if (!aheadValid || aheadBlock != blockAddress) return (aheadValid = false);
+    memcpy(data, aheadBuffer, 512);
+    return true;
+  }
+
+#endif
+
 bool SDIO_ReadBlock(uint32_t blockAddress, uint8_t *data) {
+  #if ENABLED(SDIO_READ_AHEAD)
+    if (SDIO_ReadAheadTake(blockAddress, data)) {
+      SDIO_ReadAheadStart(blockAddress + 1);
+      return true;
+    }
+  #endif
   uint32_t retries = SDIO_READ_RETRIES;
-  while (retries--) if (SDIO_ReadBlock_DMA(blockAddress, data)) return true;
+  while (retries--) if (SDIO_ReadBlock_DMA(blockAddress, data)) {
+    TERN_(SDIO_READ_AHEAD, SDIO_ReadAheadStart(blockAddress + 1));
+    return true;
+  }
   return false;
 }
 
+// Read consecutive blocks with as few CMD18 transfers as possible
+bool SDIO_ReadBlocks(uint32_t blockAddress, uint8_t *data, uint32_t count) {
+  TERN_(SDIO_READ_AHEAD, SDIO_ReadAheadDrop());
+  while (count) {
+    const uint16_t n = _MIN(count, SDIO_MAX_MULT_BLOCKS);
+    uint32_t retries = SDIO_READ_RETRIES;
+    while (!SDIO_ReadBlock_DMA(blockAddress, data, n)) if (!--retries) return false;
+    blockAddress += n;
+    data += 512U * n;
+    count -= n;
+  }
+  return true;
+}
+
 uint32_t millis();
 
-bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
+// Wait for the card to finish programming
+static bool SDIO_WaitWriteDone() {
+  uint32_t timeout = millis() + SDIO_WRITE_TIMEOUT;
+  while (timeout > millis()) {
+    if (SDIO_GetCardState() == SDIO_CARD_TRANSFER) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SDIO_WriteBlock_DMA(uint32_t blockAddress, const uint8_t *data, const uint16_t count=1) {
   if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return false;
-  if (blockAddress >= SdCard.LogBlockNbr) return false;
+  if (blockAddress + count > SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
 
   if (SdCard.CardType != CARD_SDHC_SDXC) { blockAddress *= 512U; }
 
   dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, (volatile void *) data, DMA_SIZE_32BITS, DMA_MINC_MODE | DMA_FROM_MEM);
-  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128);
+  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128U * count);
   dma_clear_isr_bits(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_enable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
-  if (!SDIO_CmdWriteSingleBlock(blockAddress)) {
+  if (!(count > 1 ? SDIO_CmdWriteMultBlock(blockAddress) : SDIO_CmdWriteSingleBlock(blockAddress))) {
     dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
     return false;
   }
 
-  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN);
+  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U * count, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN);
 
   while (!SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) { /* wait */ }
 
   dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
-  if (SDIO_GET_FLAG(SDIO_STA_TRX_ERROR_FLAGS)) {
-    SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
-    return false;
-  }
-
+  const bool failed = SDIO_GET_FLAG(SDIO_STA_TRX_ERROR_FLAGS);
   SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
 
-  uint32_t timeout = millis() + SDIO_WRITE_TIMEOUT;
-  while (timeout > millis()) {
-    if (SDIO_GetCardState() == SDIO_CARD_TRANSFER) {
-      return true;
-    }
+  // A multi-block write goes on until it's stopped, even after an error
+  if (count > 1 && !SDIO_CmdStopTransfer()) return false;
+
+  return !failed && SDIO_WaitWriteDone();
+}
+
+bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
+  TERN_(SDIO_READ_AHEAD, SDIO_ReadAheadDrop());
+  return SDIO_WriteBlock_DMA(blockAddress, data);
+}
+
+// Write consecutive blocks with as few CMD25 transfers as possible
+bool SDIO_WriteBlocks(uint32_t blockAddress, const uint8_t *data, uint32_t count) {
+  TERN_(SDIO_READ_AHEAD, SDIO_ReadAheadDrop());
+  while (count) {
+    const uint16_t n = _MIN(count, SDIO_MAX_MULT_BLOCKS);
+    if (!SDIO_WriteBlock_DMA(blockAddress, data, n)) return false;
+    blockAddress += n;
+    data += 512U * n;
+    count -= n;
   }
-  return false;
+  return true;
 }
 
 inline uint32_t SDIO_GetCardState() { return SDIO_CmdSendStatus(SdCard.RelCardAdd << 16U) ? (SDIO_GetResponse(SDIO_RESP1) >> 9U) & 0x0FU : SDIO_CARD_ERROR; }
@@ -201,6 +303,9 @@ bool SDIO_CmdSendCSD(uint32_t argument) { SDIO_SendCommand(CMD9_SEND_CSD, argume
 bool SDIO_CmdSendStatus(uint32_t argument) { SDIO_SendCommand(CMD13_SEND_STATUS, argument); return SDIO_GetCmdResp1(SDMMC_CMD_SEND_STATUS); }
 bool SDIO_CmdReadSingleBlock(uint32_t address) { SDIO_SendCommand(CMD17_READ_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_SINGLE_BLOCK); }
 bool SDIO_CmdWriteSingleBlock(uint32_t address) { SDIO_SendCommand(CMD24_WRITE_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_WRITE_SINGLE_BLOCK); }
+bool SDIO_CmdReadMultBlock(uint32_t address) { SDIO_SendCommand(CMD18_READ_MULT_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_MULT_BLOCK); }
+bool SDIO_CmdWriteMultBlock(uint32_t address) { SDIO_SendCommand(CMD25_WRITE_MULT_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_WRITE_MULT_BLOCK); }
+bool SDIO_CmdStopTransfer() { SDIO_SendCommand(CMD12_STOP_TRANSMISSION, 0); return SDIO_GetCmdResp1(SDMMC_CMD_STOP_TRANSMISSION); }
 bool SDIO_CmdAppCommand(uint32_t rsa) { SDIO_SendCommand(CMD55_APP_CMD, rsa); return SDIO_GetCmdResp1(SDMMC_CMD_APP_CMD); }
 
 bool SDIO_CmdAppSetBusWidth(uint32_t rsa, uint32_t argument) {
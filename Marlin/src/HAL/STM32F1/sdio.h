@@ -36,9 +36,12 @@
 #define SDMMC_CMD_SEL_DESEL_CARD                      ((uint8_t)7)   /* Selects the card by its own relative address and gets deselected by any other address */
 #define SDMMC_CMD_HS_SEND_EXT_CSD                     ((uint8_t)8)   /* Sends SD Memory Card interface condition, which includes host supply voltage information and asks the card whether card supports voltage. */
 #define SDMMC_CMD_SEND_CSD                            ((uint8_t)9)   /* Addressed card sends its card specific data (CSD) on the CMD line. */
+#define SDMMC_CMD_STOP_TRANSMISSION                   ((uint8_t)12)  /* Forces the card to stop transmission. */
 #define SDMMC_CMD_SEND_STATUS                         ((uint8_t)13)  /*!< Addressed card sends its status register. */
 #define SDMMC_CMD_READ_SINGLE_BLOCK                   ((uint8_t)17)  /* Reads single block of size selected by SET_BLOCKLEN in case of SDSC, and a block of fixed 512 bytes in case of SDHC and SDXC. */
+#define SDMMC_CMD_READ_MULT_BLOCK                     ((uint8_t)18)  /* Continuously transfers data blocks from card to host until interrupted by STOP_TRANSMISSION command. */
 #define SDMMC_CMD_WRITE_SINGLE_BLOCK                  ((uint8_t)24)  /* Writes single block of size selected by SET_BLOCKLEN in case of SDSC, and a block of fixed 512 bytes in case of SDHC and SDXC. */
+#define SDMMC_CMD_WRITE_MULT_BLOCK                    ((uint8_t)25)  /* Continuously writes blocks of data until a STOP_TRANSMISSION follows. */
 #define SDMMC_CMD_APP_CMD                             ((uint8_t)55)  /* Indicates to the card that the next command is an application specific command rather than a standard command. */
 
 #define SDMMC_ACMD_APP_SD_SET_BUSWIDTH                ((uint8_t)6)   /* (ACMD6) Defines the data bus width to be used for data transfer. The allowed data bus widths are given in SCR register. */
@@ -51,9 +54,12 @@
 #define CMD7_SEL_DESEL_CARD                           (uint16_t)(SDMMC_CMD_SEL_DESEL_CARD | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD8_HS_SEND_EXT_CSD                          (uint16_t)(SDMMC_CMD_HS_SEND_EXT_CSD | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD9_SEND_CSD                                 (uint16_t)(SDMMC_CMD_SEND_CSD | SDIO_CMD_WAIT_LONG_RESP)
+#define CMD12_STOP_TRANSMISSION                       (uint16_t)(SDMMC_CMD_STOP_TRANSMISSION | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD13_SEND_STATUS                             (uint16_t)(SDMMC_CMD_SEND_STATUS | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD17_READ_SINGLE_BLOCK                       (uint16_t)(SDMMC_CMD_READ_SINGLE_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
+#define CMD18_READ_MULT_BLOCK                         (uint16_t)(SDMMC_CMD_READ_MULT_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD24_WRITE_SINGLE_BLOCK                      (uint16_t)(SDMMC_CMD_WRITE_SINGLE_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
+#define CMD25_WRITE_MULT_BLOCK                        (uint16_t)(SDMMC_CMD_WRITE_MULT_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD55_APP_CMD                                 (uint16_t)(SDMMC_CMD_APP_CMD | SDIO_CMD_WAIT_SHORT_RESP)
 
 #define ACMD6_APP_SD_SET_BUSWIDTH                     (uint16_t)(SDMMC_ACMD_APP_SD_SET_BUSWIDTH | SDIO_CMD_WAIT_SHORT_RESP)
@@ -99,6 +105,7 @@
 #define SDIO_CMDTIMEOUT                      200U           /* Command send and response timeout */
 #define SDIO_DATA_TIMEOUT                    100U           /* Read data transfer timeout */
 #define SDIO_WRITE_TIMEOUT                   200U           /* Write data transfer timeout */
+#define SDIO_MAX_MULT_BLOCKS                 511U           /* Blocks per multi-block DMA transfer (DMA count is 16-bit) */
 
 #ifndef SDIO_CLOCK
   #define SDIO_CLOCK                         18000000       /* 18 MHz */
@@ -123,6 +130,8 @@ typedef struct {
   uint32_t LogBlockSize;  // Logical block size in bytes
 } SDIO_CardInfoTypeDef;
 
+extern SDIO_CardInfoTypeDef SdCard;
+
 // ------------------------
 // Public functions
 // ------------------------
@@ -138,6 +147,9 @@ bool SDIO_CmdSendCSD(uint32_t argument);
 bool SDIO_CmdSendStatus(uint32_t argument);
 bool SDIO_CmdReadSingleBlock(uint32_t address);
 bool SDIO_CmdWriteSingleBlock(uint32_t address);
+bool SDIO_CmdReadMultBlock(uint32_t address);
+bool SDIO_CmdWriteMultBlock(uint32_t address);
+bool SDIO_CmdStopTransfer();
 bool SDIO_CmdAppCommand(uint32_t rsa);
 
 bool SDIO_CmdAppSetBusWidth(uint32_t rsa, uint32_t argument);
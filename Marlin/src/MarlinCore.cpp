@@ -181,6 +181,14 @@
   #include "feature/runout.h"
 #endif
 
+#if ENABLED(BINARY_TELEMETRY)
+  #include "feature/telemetry.h"
+#endif
+
+#if ENABLED(DEFERRED_BOOT)
+  #include "feature/boot_sequence.h"
+#endif
+
 #if HAS_Z_SERVO_PROBE
   #include "module/probe.h"
 #endif
@@ -225,6 +233,10 @@
   #include "feature/repeat_printing.h"
 #endif
 
+#if ENABLED(JOB_ANALYZER)
+  #include "feature/job_analyzer.h"
+#endif
+
 #if ENABLED(EEPROM_SETTINGS)
   #include "module/settings.h"
 #endif
@@ -515,7 +527,7 @@ inline void finishSDPrinting() {
  */
 inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 
-  if (queue.length < BUFSIZE) queue.get_available_commands();
+  if (queue.has_space()) queue.get_available_commands();
 
   const millis_t ms = millis();
 
@@ -757,6 +769,12 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Pre-scan the selected print file
+  TERN_(JOB_ANALYZER, job_analyzer.idle());
+
+  // Bring up peripherals deferred from setup()
+  TERN_(DEFERRED_BOOT, boot.idle());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, Sd2Card::idle());
 
@@ -770,7 +788,11 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   TERN_(USE_BEEPER, buzzer.tick());
 
   // Handle UI input / draw events
-  TERN(HAS_DWIN_LCD, DWIN_Update(), ui.update());
+  #if HAS_DWIN_LCD
+    if (TERN1(DEFERRED_BOOT, boot.ready(BOOT_LCD))) DWIN_Update();
+  #else
+    ui.update();
+  #endif
   
   // Run i2c Position Encoders
   #if ENABLED(I2C_POSITION_ENCODERS)
@@ -789,6 +811,7 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
     if (!gcode.autoreport_paused) {
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_report_temperatures());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_report_sd_status());
+      TERN_(BINARY_TELEMETRY, telemetry.idle());
     }
   #endif
 
@@ -996,37 +1019,43 @@ void setup() {
     #endif
   #endif
 
+  // Ports are usable as soon as they begin. Deferred boot doesn't wait for them.
+  #if ENABLED(DEFERRED_BOOT)
+    #define SERIAL_CONNECT_WAIT(...) NOOP
+  #else
+    #define SERIAL_CONNECT_WAIT(V) do{ \
+      const millis_t serial_connect_timeout = millis() + 1000UL; \
+      while ((V) && PENDING(millis(), serial_connect_timeout)) { /*nada*/ } \
+    }while(0)
+  #endif
+
 	  MYSERIAL0.begin(BAUDRATE);
-	  uint32_t serial_connect_timeout = millis() + 1000UL;
-		while (!MYSERIAL0 && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
+	  SERIAL_CONNECT_WAIT(!MYSERIAL0);
 	
   #if HAS_WIFI_SERIAL
 		#if(WIFI_SERIAL_PORT == 2)
 		Uart2_Remap_Enabled();
 		#endif
 		WIFI_SERIAL.begin(WIFI_BAUDRATE);
-	  serial_connect_timeout = millis() + 1000UL;
-	  while (/*!WIFI_SERIAL && */PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
+	  SERIAL_CONNECT_WAIT(true /*!WIFI_SERIAL*/);
   #elif BOTH(HAS_TFT_LVGL_UI, USE_WIFI_FUNCTION)
     mks_esp_wifi_init();
     WIFISERIAL.begin(WIFI_BAUDRATE);
-    serial_connect_timeout = millis() + 1000UL;
-    while (/*!WIFISERIAL && */PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
+    SERIAL_CONNECT_WAIT(true /*!WIFISERIAL*/);
   #endif
   
   #if HAS_LCD_SERIAL
     LCD_SERIAL.begin(BAUDRATE);
-    serial_connect_timeout = millis() + 1000UL;
-    while (/*!LCD_SERIAL && */PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
+    SERIAL_CONNECT_WAIT(true /*!LCD_SERIAL*/);
 	#endif
 	
 	#if HAS_MYSERIAL1
 	  MYSERIAL1.begin(BAUDRATE);
-    serial_connect_timeout = millis() + 1000UL;
-    while (/*!MYSERIAL1 && */PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
+    SERIAL_CONNECT_WAIT(true /*!MYSERIAL1*/);
   #endif
 	
   SERIAL_ECHO_MSG("start");
+  TERN_(DEFERRED_BOOT, boot.report(PSTR("serial"), 0));
 
   SETUP_RUN(HAL_init());
 
@@ -1092,7 +1121,7 @@ void setup() {
     );
   #endif
   SERIAL_ECHO_MSG("Compiled: " __DATE__);
-  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (int)sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (int)(sizeof(block_t) + sizeof(block_plan_t)) * (BLOCK_BUFFER_SIZE));
 
   // Init buzzer pin(s)
   #if USE_BEEPER
@@ -1115,11 +1144,14 @@ void setup() {
   // UI must be initialized before EEPROM
   // (because EEPROM code calls the UI).
   #if HAS_DWIN_LCD
-    delay(800);   // Required delay (since boot?)
-    SERIAL_ECHOPGM("\nDWIN handshake ");
-    if (dwinLCD.Handshake()) SERIAL_ECHOLNPGM("ok."); else SERIAL_ECHOLNPGM("error.");
-    dwinLCD.Frame_SetDir(1); // Orientation 90°
-    dwinLCD.UpdateLCD();     // Show bootscreen (first image)
+    // EEPROM code only sets DWIN flags, so deferred boot shakes hands later
+    #if DISABLED(DEFERRED_BOOT)
+      delay(800);   // Required delay (since boot?)
+      SERIAL_ECHOPGM("\nDWIN handshake ");
+      if (dwinLCD.Handshake()) SERIAL_ECHOLNPGM("ok."); else SERIAL_ECHOLNPGM("error.");
+      dwinLCD.Frame_SetDir(1); // Orientation 90°
+      dwinLCD.UpdateLCD();     // Show bootscreen (first image)
+    #endif
   #else
     SETUP_RUN(ui.init());
     #if HAS_WIRED_LCD && ENABLED(SHOW_BOOTSCREEN)
@@ -1132,8 +1164,10 @@ void setup() {
     SETUP_RUN(card.mount());          // Mount media with settings before first_load
   #endif
 
+  TERN_(DEFERRED_BOOT, const millis_t settings_ms = millis());
   SETUP_RUN(settings.first_load());   // Load data from EEPROM if available (or use defaults)
                                       // This also updates variables in the planner, elsewhere
+  TERN_(DEFERRED_BOOT, boot.report(PSTR("settings"), settings_ms));
   #if HAS_TOUCH_XPT2046
     SETUP_RUN(touch.init());
   #endif
@@ -1143,6 +1177,7 @@ void setup() {
   sync_plan_position();               // Vital to init stepper/planner equivalent for current_position
 
   SETUP_RUN(thermalManager.init());   // Initialize temperature loop
+  TERN_(DEFERRED_BOOT, boot.report(PSTR("heaters"), 0));
 
   SETUP_RUN(print_job_timer.init());  // Initial setup of print job timer
 
@@ -1306,9 +1341,8 @@ void setup() {
     SERIAL_ECHO_TERNARY(err, "BL24CXX Check ", "failed", "succeeded", "!\n");
   #endif
 
-  #if HAS_DWIN_LCD    
+  #if HAS_DWIN_LCD && DISABLED(DEFERRED_BOOT)
     HMI_Init();
-		
   #endif
 
   #if HAS_SERVICE_INTERVALS && DISABLED(HAS_DWIN_LCD)
@@ -1331,11 +1365,18 @@ void setup() {
   #endif
 
   TERN_(PASSWORD_ON_STARTUP,SETUP_RUN(password.lock_machine()));
-  TERN_(OPTION_WIFI_MODULE,	SETUP_RUN(WIFI_onoff()));
+  #if DISABLED(DEFERRED_BOOT)
+    TERN_(OPTION_WIFI_MODULE,	SETUP_RUN(WIFI_onoff()));
+  #endif
   TERN_(OPTION_REPEAT_PRINTING,	SETUP_RUN(ReprintManager.Init()));
 
   marlin_state = MF_RUNNING;
 
+  #if ENABLED(DEFERRED_BOOT)
+    boot.report(PSTR("setup"), 0);
+    boot.start();
+  #endif
+
   SETUP_LOG("setup() completed.");
 }
 
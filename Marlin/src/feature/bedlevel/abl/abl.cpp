@@ -134,6 +134,24 @@ void extrapolate_unprobed_bed_level() {
 
 }
 
+#if ENABLED(ADAPTIVE_MESH_PROBING)
+
+  /**
+   * A partial grid of points.x * points.y is probed at the low corner of
+   * z_values. The points past it lie beyond the print area, so hold them
+   * level with the nearest probed edge, as bilinear_z_offset does beyond
+   * the grid.
+   */
+  void extend_bed_level(const xy_uint8_t &points) {
+    LOOP_L_N(x, GRID_MAX_POINTS_X) LOOP_L_N(y, GRID_MAX_POINTS_Y) {
+      if (x < points.x && y < points.y) continue;
+      z_values[x][y] = z_values[_MIN(x, points.x - 1)][_MIN(y, points.y - 1)];
+      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+    }
+  }
+
+#endif // ADAPTIVE_MESH_PROBING
+
 void print_bilinear_leveling_grid() {
   SERIAL_ECHOLNPGM("Bilinear Leveling Grid:");
   print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 3,
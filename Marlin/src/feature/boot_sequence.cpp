@@ -0,0 +1,181 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/boot_sequence.cpp - Bring up the display, media and Wi-Fi after setup()
+ *
+ * setup() only does what motion, heaters and the host link depend on. The
+ * slow peripherals are stepped from idle() against millis() deadlines, so the
+ * host can connect and the heaters are regulated while the display is still
+ * waking up. Each stage reports how long it took and when it finished.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(DEFERRED_BOOT)
+
+#include "boot_sequence.h"
+
+#if HAS_DWIN_LCD
+  #include "../lcd/dwin/dwin_lcd.h"
+  #include "../lcd/dwin/dwin_ui/dwin.h"
+#endif
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+#if ENABLED(OPTION_WIFI_MODULE)
+  #include "../MarlinCore.h"
+#endif
+
+BootSequence boot;
+
+#define DWIN_STARTUP_MS       800  // The display ignores commands until this long after power-up
+#define DWIN_HANDSHAKE_MS     100  // Time allowed for each handshake reply
+#define DWIN_HANDSHAKE_TRIES   10  // Quick tries before falling back to DWIN_RETRY_MS
+#define DWIN_RETRY_MS        1000  // Interval of the handshake retries after that
+#define DWIN_RETRY_STEP      (DWIN_HANDSHAKE_TRIES + 1)
+#define DWIN_SHOW_STEP       (DWIN_HANDSHAKE_TRIES + 2)
+#define WIFI_RESET_STEP_MS     10
+
+bool BootSequence::running; // = false
+uint8_t BootSequence::done, BootSequence::step[BOOT_STAGES];
+millis_t BootSequence::start_ms[BOOT_STAGES], BootSequence::next_ms[BOOT_STAGES];
+
+void BootSequence::report(PGM_P const name, const millis_t start_ms) {
+  const millis_t ms = millis();
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Boot ");
+  serialprintPGM(name);
+  SERIAL_ECHOLNPAIR(": ", ms - start_ms, "ms (at ", ms, "ms)");
+}
+
+void BootSequence::start() {
+  const millis_t ms = millis();
+  LOOP_L_N(s, BOOT_STAGES) { step[s] = 0; start_ms[s] = next_ms[s] = ms; }
+  done = 0;
+  if (DISABLED(HAS_DWIN_LCD))       SBI(done, BOOT_LCD);
+  if (DISABLED(SDSUPPORT))          SBI(done, BOOT_MEDIA);
+  if (DISABLED(OPTION_WIFI_MODULE)) SBI(done, BOOT_WIFI);
+  running = !complete();
+}
+
+void BootSequence::finish(const BootStage s, PGM_P const name) {
+  SBI(done, s);
+  report(name, start_ms[s]);
+  if (complete()) {
+    running = false;
+    report(PSTR("ready"), 0);
+  }
+}
+
+void BootSequence::idle() {
+  if (!running) return;
+  const millis_t ms = millis();
+  if (!ready(BOOT_MEDIA)) media_task(ms);
+  if (!ready(BOOT_WIFI)) wifi_task(ms);
+  if (!ready(BOOT_LCD)) lcd_task(ms);
+}
+
+/**
+ * Handshake once the display has had time to start. After a few quick
+ * tries the handshake is retried every DWIN_RETRY_MS until the display
+ * answers; DWIN_Update doesn't run until then. The bootscreen stays up
+ * until the first mount has been tried because the main menu shows the
+ * media state.
+ */
+void BootSequence::lcd_task(const millis_t ms) {
+  #if HAS_DWIN_LCD
+    uint8_t &st = step[BOOT_LCD];
+    millis_t &next = next_ms[BOOT_LCD];
+    switch (st) {
+      default: // Handshake requests
+        if (st == 0 && PENDING(ms, DWIN_STARTUP_MS)) return;
+        if (st > 0) {
+          const bool ok = dwinLCD.Handshake_Reply();
+          if (!ok && PENDING(ms, next)) return;
+          if (ok) {
+            SERIAL_ECHOLNPGM("\nDWIN handshake ok.");
+            dwinLCD.Frame_SetDir(1); // Orientation 90°
+            dwinLCD.UpdateLCD();     // Show bootscreen (first image)
+            HMI_InitStart();
+            HMI_ShowBootProgress(ready(BOOT_MEDIA) ? 50 : 0);
+            st = DWIN_SHOW_STEP;
+            return;
+          }
+          if (st == DWIN_HANDSHAKE_TRIES) SERIAL_ECHOLNPGM("\nDWIN handshake error. Retrying.");
+        }
+        dwinLCD.Handshake_Request();
+        if (st < DWIN_RETRY_STEP) st++;
+        next = ms + (st < DWIN_RETRY_STEP ? DWIN_HANDSHAKE_MS : DWIN_RETRY_MS);
+        break;
+
+      case DWIN_SHOW_STEP:
+        if (!ready(BOOT_MEDIA)) return;
+        HMI_ShowBootProgress(100);
+        HMI_InitFinish();
+        finish(BOOT_LCD, PSTR("lcd"));
+        break;
+    }
+  #else
+    UNUSED(ms);
+  #endif
+}
+
+/**
+ * The first card.manage_media() in idle() mounts the card without the
+ * insertion settle delay, so this stage only records when that happened.
+ * With SD_BACKGROUND_SCAN the mount takes a few calls to finish.
+ */
+void BootSequence::media_task(const millis_t ms) {
+  UNUSED(ms);
+  if (TERN0(SD_BACKGROUND_SCAN, card.isMounting())) return;
+  finish(BOOT_MEDIA, PSTR("media"));
+}
+
+// Pulse the module reset and set the enable line without blocking (see WIFI_onoff)
+void BootSequence::wifi_task(const millis_t ms) {
+  #if ENABLED(OPTION_WIFI_MODULE)
+    uint8_t &st = step[BOOT_WIFI];
+    millis_t &next = next_ms[BOOT_WIFI];
+    if (PENDING(ms, next)) return;
+    switch (st++) {
+      case 0: OUT_WRITE(WIFI_RST, LOW); break;
+      case 1: OUT_WRITE(WIFI_RST, HIGH); break;
+      case 2:
+        if (WiFi_Enabled) {
+          WiFi_Connected_fail = false;
+          OUT_WRITE(WIFI_EN, HIGH);
+        }
+        else
+          OUT_WRITE(WIFI_EN, LOW);
+        break;
+      default: finish(BOOT_WIFI, PSTR("wifi")); return;
+    }
+    next = ms + WIFI_RESET_STEP_MS;
+  #else
+    UNUSED(ms);
+  #endif
+}
+
+#endif // DEFERRED_BOOT
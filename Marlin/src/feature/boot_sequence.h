@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/boot_sequence.h - Bring up the display, media and Wi-Fi after setup()
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+enum BootStage : uint8_t {
+  BOOT_LCD,                               // Display handshake, bootscreen and main menu
+  BOOT_MEDIA,                             // First SD mount and root listing
+  BOOT_WIFI,                              // Wi-Fi module reset and enable
+  BOOT_STAGES
+};
+
+class BootSequence {
+public:
+  static void report(PGM_P const name, const millis_t start_ms);
+
+  // Called at the end of setup() and then from idle() until all stages are done
+  static void start();
+  static void idle();
+
+  static inline bool ready(const BootStage s) { return TEST(done, s); }
+  static inline bool complete() { return done == _BV(BOOT_STAGES) - 1; }
+
+private:
+  static bool running;
+  static uint8_t done, step[BOOT_STAGES];
+  static millis_t start_ms[BOOT_STAGES], next_ms[BOOT_STAGES];
+
+  static void finish(const BootStage s, PGM_P const name);
+
+  static void lcd_task(const millis_t ms);
+  static void media_task(const millis_t ms);
+  static void wifi_task(const millis_t ms);
+};
+
+extern BootSequence boot;
@@ -71,6 +71,11 @@ namespace DirectStepping {
   template<typename Cfg>
   typename Cfg::write_byte_idx_t SerialPageManager<Cfg>::write_page_size;
 
+  #if ENABLED(DIRECT_STEPPING_SD)
+    template<typename Cfg>
+    bool SerialPageManager<Cfg>::local;
+  #endif
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::init() {
     for (int i = 0 ; i < Cfg::NUM_PAGES ; i++)
@@ -180,6 +185,8 @@ namespace DirectStepping {
     if (!page_states_dirty) return;
     page_states_dirty = false;
 
+    if (TERN0(DIRECT_STEPPING_SD, local)) return;
+
     SERIAL_ECHO(Cfg::CONTROL_CHAR);
     constexpr int state_bits = 2;
     constexpr int n_bytes = Cfg::NUM_PAGES >> state_bits;
@@ -219,6 +226,27 @@ namespace DirectStepping {
     set_page_state(page_idx, PageState::FREE);
   }
 
+  #if ENABLED(DIRECT_STEPPING_SD)
+
+    template <>
+    bool PageManager::claim_page(page_idx_t &page_idx) {
+      for (page_idx_t i = 0; i < Config::NUM_PAGES; i++)
+        if (page_states[i] == PageState::FREE) {
+          page_states[i] = PageState::WRITING;
+          page_idx = i;
+          return true;
+        }
+      return false;
+    }
+
+    template <>
+    void PageManager::commit_page(const page_idx_t page_idx) {
+      CHECK_PAGE_STATE(page_idx,, PageState::WRITING);
+      page_states[page_idx] = PageState::OK;
+    }
+
+  #endif
+
 };
 
 DirectStepping::PageManager page_manager;
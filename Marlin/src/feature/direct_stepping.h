@@ -61,6 +61,13 @@ namespace DirectStepping {
     static uint8_t *get_page(const page_idx_t page_idx);
     static void free_page(const page_idx_t page_idx);
 
+    #if ENABLED(DIRECT_STEPPING_SD)
+      // Pages filled on board by an SD step job. The host gets no page states meanwhile.
+      static bool claim_page(page_idx_t &page_idx);
+      static void commit_page(const page_idx_t page_idx);
+      static bool local;
+    #endif
+
   protected:
 
     typedef typename Cfg::write_byte_idx_t write_byte_idx_t;
@@ -0,0 +1,419 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Job Analyzer
+ *
+ * While the file list is shown the highlighted print file is read in idle
+ * slices through GCodeScanner. Each move is timed as a trapezoid under the
+ * planner's feedrate and acceleration limits, entering at the speed its
+ * junction with the last move allows (jerk or junction deviation). With only
+ * one move of look-ahead the estimate still strays, so the remaining time is
+ * scaled by the progress actually made.
+ *
+ * The results are saved beside the file as NAME.JOB, keyed by the file size
+ * and date, so selecting the file again needs no scan.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(JOB_ANALYZER)
+
+#include "job_analyzer.h"
+#include "../sd/cardreader.h"
+#include "../module/planner.h"
+#include "../core/serial.h"
+
+#if ENABLED(MIXING_EXTRUDER)
+  #include "mixing.h"
+#endif
+
+JobAnalyzer job_analyzer;
+
+job_info_t JobAnalyzer::info;
+SdFile JobAnalyzer::dir, JobAnalyzer::file;
+char JobAnalyzer::sidecar[FILENAME_LENGTH];
+uint32_t JobAnalyzer::cluster;
+bool JobAnalyzer::done; // = false
+
+GCodeScanner JobAnalyzer::scanner;
+char JobAnalyzer::line[MAX_CMD_SIZE];
+uint8_t JobAnalyzer::line_len;
+uint32_t JobAnalyzer::line_end;
+uint8_t JobAnalyzer::step;
+float JobAnalyzer::part_second, JobAnalyzer::layer_z;
+float JobAnalyzer::move_len, JobAnalyzer::move_speed, JobAnalyzer::move_accel, JobAnalyzer::move_entry;
+xyz_float_t JobAnalyzer::move_dir;
+#if ENABLED(MIXING_EXTRUDER)
+  float JobAnalyzer::mix[MIXING_STEPPERS], JobAnalyzer::collect[MIXING_STEPPERS];
+  uint8_t JobAnalyzer::vtool;
+#endif
+
+#define JOB_SIDECAR_MAGIC 0x4A42 // "JB"
+
+typedef struct {
+  uint16_t magic, length;
+  job_info_t info;
+} job_sidecar_t;
+
+// Find a parameter in the scanned line
+static bool lineValue(const char *p, const char code, float &v) {
+  for (p++; *p && *p != ';'; p++) if (*p == code) {
+    char *end;
+    v = strtof(p + 1, &end);
+    return end != p + 1;
+  }
+  return false;
+}
+
+// Time to move dist from speed v0 to v1, cruising at v (mm/s) with acceleration a (mm/s^2)
+static float moveTime(const float dist, const float v0, const float v, const float v1, const float a) {
+  if (v <= 0 || a <= 0) return 0;
+  const float up = (sq(v) - sq(v0)) / (2 * a), down = (sq(v) - sq(v1)) / (2 * a);
+  if (up + down <= dist) return (dist - up - down) / v + (2 * v - v0 - v1) / a;
+  // Too short to cruise. Peak where the ramps meet.
+  const float peak = SQRT(a * dist + 0.5f * (sq(v0) + sq(v1)));
+  return peak > _MAX(v0, v1) ? (2 * peak - v0 - v1) / a : 2 * dist / (v0 + v1);
+}
+
+// Speed a move in direction dir may start from or come to rest at
+static float stopSpeed(const xyz_float_t &dir, const float v) {
+  #if ENABLED(CLASSIC_JERK)
+    float s = v;
+    LOOP_XYZ(i) if (ABS(dir[i]) * s > planner.max_jerk[i]) s = planner.max_jerk[i] / ABS(dir[i]);
+    return s;
+  #else
+    UNUSED(dir);
+    return _MIN(v, float(MINIMUM_PLANNER_SPEED));
+  #endif
+}
+
+// Junction speed between two moves, as the planner limits it
+static float junctionSpeed(const xyz_float_t &d0, const float v0, const xyz_float_t &d1, const float v1, const float accel) {
+  #if ENABLED(CLASSIC_JERK)
+    UNUSED(accel);
+    float vj = _MIN(v0, v1);
+    LOOP_XYZ(i) {
+      // Coasting, or an axis reversal
+      const float jerk = d0[i] * d1[i] < 0 ? _MAX(ABS(d0[i]), ABS(d1[i])) : ABS(d0[i] - d1[i]);
+      if (jerk * vj > planner.max_jerk[i]) vj = planner.max_jerk[i] / jerk;
+    }
+    const float s0 = stopSpeed(d0, v0), s1 = stopSpeed(d1, v1);
+    if (s0 > vj * 0.99f && s1 > vj * 0.99f) vj = s1;
+    return vj;
+  #else
+    float junction_cos_theta = -(d0.x * d1.x + d0.y * d1.y + d0.z * d1.z);
+    if (junction_cos_theta > 0.999999f) return _MIN(v0, v1, float(MINIMUM_PLANNER_SPEED));
+    NOLESS(junction_cos_theta, -0.999999f);
+    const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta));
+    return _MIN(v0, v1, SQRT(accel * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2)));
+  #endif
+}
+
+void JobAnalyzer::select(const char * const dosname) {
+  SdFile d = card.getWorkDir(), f;
+  if (!f.open(&d, dosname, O_READ)) return;
+
+  // Already scanning or scanned?
+  if ((done || isScanning()) && f.firstCluster() == cluster && f.fileSize() == info.size) return;
+
+  cancel();
+  dir = d;
+  if (!file.open(&dir, dosname, O_READ)) return;
+  cluster = file.firstCluster();
+
+  dir_t entry;
+  if (!file.dirEntry(&entry)) return cancel();
+  info.size = file.fileSize();
+  info.date = entry.lastWriteDate;
+  info.time = entry.lastWriteTime;
+
+  // The sidecar has the same DOS name with .JOB
+  strcpy(sidecar, dosname);
+  char *ext = strchr(sidecar, '.');
+  strcpy(ext ? ext : sidecar + strlen(sidecar), ".JOB");
+
+  if (loadSidecar()) {
+    file.close();
+    done = true;
+  }
+  else
+    reset();
+}
+
+void JobAnalyzer::cancel() {
+  file.close();
+  done = false;
+  cluster = 0;
+}
+
+void JobAnalyzer::reset() {
+  done = false;
+  scanner.reset();
+  line_len = step = 0;
+  line_end = 0;
+  part_second = layer_z = 0;
+  move_len = 0;
+  info.layers = 0;
+  info.seconds = 0;
+  ZERO(info.filament);
+  info.min.set(X_MAX_POS, Y_MAX_POS);
+  info.max.set(X_MIN_POS, Y_MIN_POS);
+  TERN_(MIXING_EXTRUDER, loadTool(mixer.get_current_vtool()));
+}
+
+#if ENABLED(MIXING_EXTRUDER)
+
+  // Tn selects the stored mix, as the mixer would
+  void JobAnalyzer::loadTool(const uint8_t t) {
+    vtool = t;
+    MIXER_STEPPER_LOOP(i) collect[i] = mixer.color[t][i];
+    commitMix();
+  }
+
+  void JobAnalyzer::commitMix() {
+    float total = 0;
+    MIXER_STEPPER_LOOP(i) total += collect[i];
+    if (total > 0) MIXER_STEPPER_LOOP(i) mix[i] = collect[i] / total;
+  }
+
+#endif
+
+void JobAnalyzer::addTime(const float t) {
+  part_second += t;
+  if (part_second >= 1) {
+    const uint32_t s = part_second;
+    info.seconds += s;
+    part_second -= s;
+  }
+}
+
+// Time the last move, leaving it at the given speed
+void JobAnalyzer::endMove(const float exit_speed) {
+  if (!move_len) return;
+  addTime(moveTime(move_len, move_entry, move_speed, exit_speed, move_accel));
+  move_len = 0;
+}
+
+// Time the last move to a full stop
+void JobAnalyzer::stop() { endMove(stopSpeed(move_dir, move_speed)); }
+
+void JobAnalyzer::addMove(const bool extrude) {
+  const float de = scanner.pos.e - scanner.start.e;
+
+  #if ENABLED(MIXING_EXTRUDER)
+    MIXER_STEPPER_LOOP(i) info.filament[i] += de * mix[i];
+  #else
+    info.filament[0] += de;
+  #endif
+
+  feedRate_t v = scanner.feedrate;
+  if (scanner.length < 0.0001f) {
+    // Retract or prime, with XYZ at rest
+    if (!de) return;
+    stop();
+    NOMORE(v, planner.settings.max_feedrate_mm_s[E_AXIS]);
+    addTime(moveTime(ABS(de), 0, v, 0, planner.settings.retract_acceleration));
+    return;
+  }
+
+  const xyz_float_t dir = scanner.direction(false), end_dir = scanner.direction(true);
+  LOOP_XYZ(i) {
+    const float u = _MAX(ABS(dir[i]), ABS(end_dir[i]));
+    if (u > 0) NOMORE(v, planner.settings.max_feedrate_mm_s[i] / u);
+  }
+  const float accel = extrude ? planner.settings.acceleration : planner.settings.travel_acceleration;
+
+  // Enter at the junction speed, no faster than the last move could reach
+  float entry;
+  if (move_len) {
+    entry = junctionSpeed(move_dir, move_speed, dir, v, accel);
+    NOMORE(entry, SQRT(sq(move_entry) + 2 * move_accel * move_len));
+    endMove(entry);
+  }
+  else
+    entry = stopSpeed(dir, v);
+
+  move_len = scanner.length;
+  move_speed = v;
+  move_accel = accel;
+  move_entry = entry;
+  move_dir = end_dir;
+
+  if (extrude) {
+    // Thinner steps are Z-hops or vase mode
+    if (!info.layers || scanner.pos.z > layer_z + 0.04f) {
+      info.layers++;
+      layer_z = scanner.pos.z;
+    }
+    NOMORE(info.min.x, scanner.lo.x);
+    NOMORE(info.min.y, scanner.lo.y);
+    NOLESS(info.max.x, scanner.hi.x);
+    NOLESS(info.max.y, scanner.hi.y);
+  }
+}
+
+void JobAnalyzer::scanLine() {
+  const GCodeScanner::LineType type = scanner.scan(line);
+  float v;
+  switch (scanner.letter) {
+    case 'G':
+      if (scanner.codenum <= 3)
+        addMove(type == GCodeScanner::SCAN_EXTRUDE);
+      else if (scanner.codenum == 28)
+        stop();
+      else if (scanner.codenum == 4) {
+        stop();
+        if (lineValue(line, 'S', v)) addTime(v);
+        else if (lineValue(line, 'P', v)) addTime(v * 0.001f);
+      }
+      break;
+
+    #if ENABLED(MIXING_EXTRUDER)
+      case 'T':
+        if (scanner.codenum < MIXING_VIRTUAL_TOOLS) loadTool(scanner.codenum);
+        break;
+
+      case 'M':
+        switch (scanner.codenum) {
+          case 163:
+            if (lineValue(line, 'S', v) && WITHIN(v, 0, MIXING_STEPPERS - 1)) {
+              const uint8_t i = v;
+              collect[i] = lineValue(line, 'P', v) ? v : 0;
+            }
+            break;
+          case 164:
+            if (!lineValue(line, 'S', v) || uint8_t(v) == vtool) commitMix();
+            break;
+          case 165: {
+            const char mixing_codes[] = { LIST_N(MIXING_STEPPERS, 'A', 'B', 'C', 'D', 'H', 'I') };
+            uint8_t mix_bits = 0;
+            MIXER_STEPPER_LOOP(i) if (lineValue(line, mixing_codes[i], v)) { collect[i] = v; SBI(mix_bits, i); }
+            if (mix_bits) {
+              MIXER_STEPPER_LOOP(i) if (!TEST(mix_bits, i)) collect[i] = 0;
+              commitMix();
+            }
+          } break;
+        }
+        break;
+    #endif
+  }
+}
+
+// Read the file for a while, unless the card is in use
+void JobAnalyzer::idle() {
+  if (!isScanning()) return;
+  if (!card.isMounted()) return cancel();
+  if (card.isFileOpen()) return;
+
+  const millis_t stop = millis() + JOB_ANALYZER_SLICE_MS;
+  do {
+    uint8_t buf[64];
+    const int16_t n = file.read(buf, sizeof(buf));
+    if (n < 0) return cancel();
+    if (n == 0) return finish();
+    LOOP_L_N(i, n) {
+      const char c = buf[i];
+      line_end++;
+      if (c != '\n' && c != '\r') {
+        if (line_len < sizeof(line) - 1) line[line_len++] = c;
+        continue;
+      }
+      if (!line_len) continue;
+      line[line_len] = '\0';
+      line_len = 0;
+      scanLine();
+      while (step < JOB_PROGRESS_STEPS && line_end >= uint64_t(info.size) * (step + 1) / JOB_PROGRESS_STEPS)
+        info.progress[step++] = info.seconds;
+    }
+  } while (PENDING(millis(), stop));
+}
+
+void JobAnalyzer::finish() {
+  if (line_len) {
+    line[line_len] = '\0';
+    line_len = 0;
+    scanLine();
+  }
+  stop();
+  if (part_second >= 0.5f) info.seconds++;
+  while (step < JOB_PROGRESS_STEPS) info.progress[step++] = info.seconds;
+  saveSidecar();
+  file.close();
+  done = true;
+}
+
+bool JobAnalyzer::loadSidecar() {
+  SdFile f;
+  if (!f.open(&dir, sidecar, O_READ)) return false;
+  job_sidecar_t s;
+  const bool ok = f.read(&s, sizeof(s)) == int16_t(sizeof(s))
+    && s.magic == JOB_SIDECAR_MAGIC && s.length == sizeof(job_info_t)
+    && s.info.size == info.size && s.info.date == info.date && s.info.time == info.time;
+  f.close();
+  if (ok) info = s.info;
+  return ok;
+}
+
+void JobAnalyzer::saveSidecar() {
+  #if DISABLED(SDCARD_READONLY)
+    SdFile f;
+    if (!f.open(&dir, sidecar, O_CREAT | O_WRITE | O_TRUNC)) return;
+    const job_sidecar_t s = { JOB_SIDECAR_MAGIC, sizeof(job_info_t), info };
+    f.write(&s, sizeof(s));
+    f.close();
+  #endif
+}
+
+bool JobAnalyzer::matchesPrint() {
+  return done && card.isFileOpen() && card.getFileCluster() == cluster && card.getFileSize() == info.size;
+}
+
+// Seconds left at a file position, scaled by the elapsed print time
+uint32_t JobAnalyzer::remaining(const uint32_t sdpos, const uint32_t elapsed) {
+  if (!info.size) return 0;
+  const uint64_t pos = uint64_t(sdpos) * JOB_PROGRESS_STEPS;
+  const uint32_t s = pos / info.size;
+  if (s >= JOB_PROGRESS_STEPS) return 0;
+
+  const uint32_t t0 = s ? info.progress[s - 1] : 0;
+  const float done_est = t0 + (info.progress[s] - t0) * float(pos % info.size) / info.size;
+  float left = info.seconds - done_est;
+  if (done_est >= 120 && elapsed) left *= elapsed / done_est;
+  return left > 0 ? uint32_t(left) : 0;
+}
+
+bool JobAnalyzer::printArea(xy_pos_t &min, xy_pos_t &max) {
+  if (!matchesPrint() || !info.layers) return false;
+  min = info.min;
+  max = info.max;
+  return true;
+}
+
+void JobAnalyzer::report() {
+  SERIAL_ECHOLNPAIR("Job layers:", info.layers, " time:", info.seconds, "s X", info.min.x, ":", info.max.x, " Y", info.min.y, ":", info.max.y);
+  SERIAL_ECHOPGM("Job filament (mm)");
+  LOOP_L_N(i, JOB_FILAMENTS) SERIAL_ECHOPAIR(" ", int(i), ":", info.filament[i]);
+  SERIAL_EOL();
+}
+
+#endif // JOB_ANALYZER
@@ -0,0 +1,103 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/job_analyzer.h - Background pre-scan of print files
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../sd/SdFile.h"
+#include "../libs/gcode_scanner.h"
+
+#define JOB_PROGRESS_STEPS 50   // Estimated time is kept at every 2% of the file
+
+#if ENABLED(MIXING_EXTRUDER)
+  #define JOB_FILAMENTS MIXING_STEPPERS
+#else
+  #define JOB_FILAMENTS 1
+#endif
+
+typedef struct {
+  uint32_t size;                          // File size and last write date / time
+  uint16_t date, time;
+  uint16_t layers;
+  uint32_t seconds;                       // Estimated print time, not counting heat-up
+  uint32_t progress[JOB_PROGRESS_STEPS];  // Estimated time at each step through the file
+  float filament[JOB_FILAMENTS];          // (mm) Filament per stepper
+  xy_pos_t min, max;                      // Extents of the extruding moves
+} job_info_t;
+
+class JobAnalyzer {
+public:
+  static job_info_t info;                 // Results, once isDone()
+
+  static void select(const char * const dosname);  // Start on a file in the working directory
+  static void cancel();
+  static void idle();
+
+  static inline bool isScanning() { return file.isOpen(); }
+  static inline bool isDone() { return done; }
+
+  // The results are for the file being printed
+  static bool matchesPrint();
+
+  static uint32_t remaining(const uint32_t sdpos, const uint32_t elapsed);
+  static bool printArea(xy_pos_t &min, xy_pos_t &max);
+  static void report();
+
+private:
+  static SdFile dir, file;
+  static char sidecar[FILENAME_LENGTH];
+  static uint32_t cluster;                // Identifies the file on the volume
+  static bool done;
+
+  static GCodeScanner scanner;
+  static char line[MAX_CMD_SIZE];
+  static uint8_t line_len;
+  static uint32_t line_end;               // File position after the line
+  static uint8_t step;                    // Next progress step
+  static float part_second, layer_z;
+  static float move_len, move_speed, move_accel, move_entry;  // The last move, timed once the next sets its exit speed
+  static xyz_float_t move_dir;            // Direction at the end of the last move
+  #if ENABLED(MIXING_EXTRUDER)
+    static float mix[MIXING_STEPPERS], collect[MIXING_STEPPERS];
+  #endif
+
+  #if ENABLED(MIXING_EXTRUDER)
+    static uint8_t vtool;
+    static void loadTool(const uint8_t t);
+    static void commitMix();
+  #endif
+
+  static void reset();
+  static void addTime(const float t);
+  static void endMove(const float exit_speed);
+  static void stop();
+  static void addMove(const bool extrude);
+  static void scanLine();
+  static void finish();
+  static bool loadSidecar();
+  static void saveSidecar();
+};
+
+extern JobAnalyzer job_analyzer;
@@ -36,15 +36,25 @@ Mixer mixer;
   #include "../core/serial.h"
 #endif
 
+#if ENABLED(HOTEND_CLEAN_TOWER)
+  #include "../module/temperature.h"
+#endif
+
 // Used up to Planner level
 int8_t  	  Mixer::selected_vtool = 0;
 float         Mixer::collector[MIXING_STEPPERS]; // mix proportion. 0.0 = off, otherwise <= COLOR_A_MASK.
 mixer_comp_t  Mixer::color[NR_MIXING_VIRTUAL_TOOLS][MIXING_STEPPERS];
+mixer_comp_t  Mixer::block_color[MIXER_BLOCK_COLORS][MIXING_STEPPERS];
+uint8_t       Mixer::block_color_head = 0;
 
 // Used in Stepper
 int_fast8_t   Mixer::runner = 0;
 mixer_comp_t  Mixer::s_color[MIXING_STEPPERS];
 mixer_accu_t  Mixer::accu[MIXING_STEPPERS] = { 0 };
+#if ENABLED(LIN_ADVANCE)
+  int32_t     Mixer::s_total = 0,
+              Mixer::la_err[MIXING_STEPPERS] = { 0 };
+#endif
 mixer_perc_t Mixer::mix[MIXING_STEPPERS];
 
 
@@ -452,6 +462,48 @@ void Mixer::init() {
   TERN_(RANDOM_MIX, update_randommix_for_planner_z());
 }
 
+// The mix the next block will get
+static inline const mixer_comp_t* next_block_color() {
+  return
+    #if ENABLED(GRADIENT_MIX)
+      mixer.gradient.enabled ? mixer.gradient.color :
+    #endif
+    mixer.color[mixer.selected_vtool];
+}
+
+// True if the next block's mix is already the newest entry
+static inline bool next_color_is_head() {
+  const mixer_comp_t * const c = next_block_color();
+  MIXER_STEPPER_LOOP(i) if (mixer.block_color[mixer.block_color_head][i] != c[i]) return false;
+  return true;
+}
+
+/**
+ * Check whether the next block needs a new color entry that is still held.
+ * Queued blocks hold a contiguous run of entries starting at the tail
+ * block's, so the next entry is only free once the tail block has moved
+ * past it. The planner waits on this before it starts filling a block.
+ */
+bool Mixer::block_color_busy() {
+  const uint8_t next = (block_color_head + 1) % (MIXER_BLOCK_COLORS);
+  return planner.has_blocks_queued()
+      && planner.block_buffer[planner.block_buffer_tail].color_idx == next
+      && !next_color_is_head();
+}
+
+/**
+ * Get the block color entry for the current mix.
+ * Reuse the newest entry if the mix is unchanged, otherwise take the next
+ * one. The caller has already waited for block_color_busy() to clear.
+ */
+uint8_t Mixer::populate_block() {
+  if (next_color_is_head()) return block_color_head;
+
+  const uint8_t next = (block_color_head + 1) % (MIXER_BLOCK_COLORS);
+  MIXER_STEPPER_LOOP(i) block_color[next][i] = next_block_color()[i];
+  return (block_color_head = next);
+}
+
 void Mixer::refresh_collector(const float proportion/*=1.0*/, const uint8_t t/*=selected_vtool*/, float (&c)[MIXING_STEPPERS]/*=collector*/) {
   float csum = 0, cmax = 0;
   MIXER_STEPPER_LOOP(i) {
@@ -599,4 +651,155 @@ void Mixer::update_randommix_for_planner_z() {
     update_randommix_for_z(planner.get_axis_position_mm(Z_AXIS));
 }
 #endif//RANDOM_MIX
+
+#if ENABLED(HOTEND_CLEAN_TOWER)
+
+constexpr xy_uint_t clean_tower_pos = CLEAN_TOWER_POS;
+
+cleantower_t Mixer::cleantower = {
+  CLEAN_TOWER_PATTERN,
+  CLEAN_TOWER_TOLERANCE,
+  1.0f,                       // factor
+  clean_tower_pos.x, clean_tower_pos.y,
+  CLEAN_TOWER_LENGTH,
+  CLEAN_TOWER_VOLUME,
+  CLEAN_TOWER_RETRACT,
+  CLEAN_TOWER_RETRACT_SPEED
+};
+
+float Mixer::purged_mm, Mixer::saved_mm; // = 0
+
+// Tower rows already laid on the current layer
+static float tower_z = NAN;
+static uint8_t tower_row; // = 0
+
+/**
+ * The chamber is taken as well stirred, so what's left of the old mix falls
+ * off exponentially with the volume pushed through it. Purge until the most
+ * changed component is within the tolerance of the new mix.
+ */
+float Mixer::purge_length(const mixer_comp_t (&from)[MIXING_STEPPERS], const mixer_comp_t * const to) {
+  float fsum = 0, tsum = 0;
+  MIXER_STEPPER_LOOP(i) { fsum += from[i]; tsum += to[i]; }
+  if (!fsum || !tsum) return 0;
+
+  float diff = 0;
+  MIXER_STEPPER_LOOP(i) NOLESS(diff, ABS(from[i] / fsum - to[i] / tsum));
+
+  const float tol = cleantower.tolerance * 0.01f;
+  if (diff <= tol) return 0;
+
+  const float mm3 = cleantower.volume * cleantower.factor * logf(diff / tol);
+  return mm3 / (sq(float(DEFAULT_NOMINAL_FILAMENT_DIA) * 0.5f) * float(M_PI));
+}
+
+/**
+ * Called after the virtual tool changes. The newest block color is the mix
+ * in the chamber. Moves are queued without waiting, so the purge runs on
+ * from the print. E is set back afterwards so the job's E values still hold.
+ */
+void Mixer::build_clean_tower() {
+  if (cleantower.pattern == CLEAN_NONE || !printingIsActive() || homing_needed()
+    || thermalManager.tooColdToExtrude(0)
+  ) return;
+
+  // Selecting a tool with the same mix changes nothing in the chamber
+  if (next_color_is_head()) return;
+
+  float purge = purge_length(block_color[block_color_head], next_block_color());
+
+  // The tower carries on from the last row laid on this layer
+  constexpr float width = CLEAN_TOWER_LINE_WIDTH,
+                  e_per_mm = width * (CLEAN_TOWER_LAYER_HEIGHT) / (sq(float(DEFAULT_NOMINAL_FILAMENT_DIA) * 0.5f) * float(M_PI));
+  const bool tower = cleantower.pattern == CLEAN_TOWER;
+  if (tower && current_position.z != tower_z) { tower_z = current_position.z; tower_row = 0; }
+
+  // Purge no more than the rows left on this layer will hold
+  if (tower) {
+    const uint8_t rows = uint8_t(cleantower.length / width) + 1;
+    const float room = tower_row < rows ? (rows - tower_row) * cleantower.length * e_per_mm : 0;
+    if (purge > room) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM("Clean tower full, purge cut by ");
+      SERIAL_ECHO_F(purge - room, 1);
+      SERIAL_ECHOLNPGM("mm");
+      purge = room;
+    }
+  }
+
+  const float saved = _MAX(0.0f, float(CLEAN_TOWER_FULL_PURGE) - purge);
+  purged_mm += purge;
+  saved_mm += saved;
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR("Purge T", int(selected_vtool), " ");
+  SERIAL_ECHO_F(purge, 1);
+  SERIAL_ECHOPGM("mm, saved ");
+  SERIAL_ECHO_F(saved, 1);
+  SERIAL_ECHOPGM("mm ");
+  SERIAL_ECHO_F(saved / (CLEAN_TOWER_FEEDRATE), 1);
+  SERIAL_ECHOLNPGM("s");
+
+  if (!purge) return;
+
+  const xyze_pos_t resume = current_position;
+  const float retract = cleantower.retraction_length;
+  const feedRate_t retract_fr = cleantower.retraction_speed,
+                   z_fr = homing_feedrate(Z_AXIS);
+
+  auto move_e = [&](const float e, const feedRate_t fr) {
+    current_position.e += e;
+    line_to_current_position(fr);
+  };
+  auto move_z = [&](const float z) {
+    current_position.z = z;
+    NOMORE(current_position.z, Z_MAX_POS);
+    line_to_current_position(z_fr);
+  };
+  auto move_xy = [&](const float x, const float y, const feedRate_t fr) {
+    current_position.set(x, y);
+    line_to_current_position(fr);
+  };
+
+  uint8_t row = tower ? tower_row : 0;
+
+  // Retract and travel clear of the print
+  move_e(-retract, retract_fr);
+  move_z(resume.z + (CLEAN_TOWER_ZRAISE));
+  move_xy(cleantower.x + (TEST(row, 0) ? cleantower.length : 0), cleantower.y + row * width, CLEAN_TOWER_TRAVEL_SPEED);
+  if (tower) move_z(resume.z);
+  move_e(retract, retract_fr);
+
+  if (tower) {
+    // Zigzag the purge into the tower at this layer
+    float left = purge;
+    for (const uint8_t first = row; left > 0 && row * width <= cleantower.length; row++) {
+      if (row != first) move_xy(current_position.x, cleantower.y + row * width, CLEAN_TOWER_LINE_SPEED);
+      const float len = _MIN(float(cleantower.length), left / e_per_mm);
+      current_position.x += TEST(row, 0) ? -len : len;
+      move_e(len * e_per_mm, CLEAN_TOWER_LINE_SPEED);
+      left -= len * e_per_mm;
+    }
+    tower_row = row;
+  }
+  else
+    move_e(purge, CLEAN_TOWER_FEEDRATE);
+
+  // Retract, wipe and go back
+  move_e(-retract, retract_fr);
+  if (cleantower.pattern == CLEAN_PARK) {
+    move_xy(cleantower.x + cleantower.length, cleantower.y, CLEAN_TOWER_TRAVEL_SPEED);
+    move_xy(cleantower.x, cleantower.y, CLEAN_TOWER_TRAVEL_SPEED);
+  }
+  move_z(resume.z + (CLEAN_TOWER_ZRAISE));
+  move_xy(resume.x, resume.y, CLEAN_TOWER_TRAVEL_SPEED);
+  move_z(resume.z);
+  move_e(retract, retract_fr);
+
+  current_position.e = resume.e;
+  sync_plan_position_e();
+}
+
+#endif // HOTEND_CLEAN_TOWER
+
 #endif // MIXING_EXTRUDER
@@ -62,9 +62,17 @@ enum MixTool {
 #define MAX_VTOOLS TERN(HAS_MIXER_SYNC_CHANNEL, 254, 255)
 static_assert(NR_MIXING_VIRTUAL_TOOLS <= MAX_VTOOLS, "MIXING_VIRTUAL_TOOLS must be <= " STRINGIFY(MAX_VTOOLS) "!");
 
-#define MIXER_BLOCK_FIELD       mixer_comp_t b_color[MIXING_STEPPERS]
-#define MIXER_POPULATE_BLOCK()  mixer.populate_block(block->b_color)
-#define MIXER_STEPPER_SETUP()   mixer.stepper_setup(current_block->b_color)
+// Queued blocks share their mixes through a small table. A block only
+// takes a new entry when the mix changes from the previous block.
+#ifndef MIXER_BLOCK_COLORS
+  #define MIXER_BLOCK_COLORS 16
+#endif
+static_assert(WITHIN(MIXER_BLOCK_COLORS, 2, 255), "MIXER_BLOCK_COLORS must be from 2 to 255.");
+
+#define MIXER_BLOCK_FIELD       uint8_t color_idx
+#define MIXER_POPULATE_BLOCK()  (block->color_idx = mixer.populate_block())
+#define MIXER_HOLD_BLOCK()      (block->color_idx = mixer.block_color_head)
+#define MIXER_STEPPER_SETUP()   mixer.stepper_setup(mixer.block_color[current_block->color_idx])
 #define MIXER_STEPPER_LOOP(VAR) for (uint_fast8_t VAR = 0; VAR < MIXING_STEPPERS; VAR++)
 
 #if ENABLED(GRADIENT_MIX)
@@ -91,15 +99,17 @@ typedef struct {
 #endif
 
 #if ENABLED(HOTEND_CLEAN_TOWER)
+enum CleanTowerPattern : uint8_t { CLEAN_NONE, CLEAN_PARK, CLEAN_TOWER };
+
 typedef struct {
-  uint8_t pattern;
-  uint8_t colors;
-  float factor;
-  uint16_t x, y;
-  uint16_t length;
-  uint8_t flow_length;
-  float retraction_length;
-  int retraction_speed;
+  uint8_t pattern;            // CleanTowerPattern
+  uint8_t tolerance;          // (%) Largest mix error left in the chamber
+  float factor;               // Calibration factor for the volume
+  uint16_t x, y;              // (mm) Purge point or tower corner
+  uint16_t length;            // (mm) Wipe length or tower width
+  float volume;               // (mm³) Mixing chamber and nozzle
+  float retraction_length;    // (mm)
+  int retraction_speed;       // (mm/s)
 }cleantower_t;
 #endif
 /**
@@ -139,18 +149,22 @@ class Mixer {
   }
 
   // Used when dealing with blocks
-  FORCE_INLINE static void populate_block(mixer_comp_t b_color[MIXING_STEPPERS]) {
-    #if ENABLED(GRADIENT_MIX)
-      if (gradient.enabled) {
-        MIXER_STEPPER_LOOP(i) b_color[i] = gradient.color[i];
-        return;
-      }
-    #endif
-    MIXER_STEPPER_LOOP(i) b_color[i] = color[selected_vtool][i];
-  }
+  static mixer_comp_t block_color[MIXER_BLOCK_COLORS][MIXING_STEPPERS]; // Mixes held by queued blocks
+  static uint8_t block_color_head;                                       // The newest entry
+  static bool block_color_busy();
+  static uint8_t populate_block();
 
   FORCE_INLINE static void stepper_setup(mixer_comp_t b_color[MIXING_STEPPERS]) {
-    MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
+    #if ENABLED(LIN_ADVANCE)
+      // A new mix starts the step distribution over
+      bool same = true;
+      MIXER_STEPPER_LOOP(i) if (s_color[i] != b_color[i]) same = false;
+      if (same) return;
+      s_total = 0;
+      MIXER_STEPPER_LOOP(i) { s_color[i] = b_color[i]; s_total += b_color[i]; la_err[i] = 0; }
+    #else
+      MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
+    #endif
   }
 
     static inline void copy_mix_to_color(mixer_comp_t (&tcolor)[MIXING_STEPPERS]) {
@@ -325,7 +339,9 @@ class Mixer {
 
   #if ENABLED(HOTEND_CLEAN_TOWER)
   static cleantower_t cleantower;
-  static void build_clean_tower();
+  static float purged_mm, saved_mm;         // Totals since boot
+  static float purge_length(const mixer_comp_t (&from)[MIXING_STEPPERS], const mixer_comp_t * const to);
+  static void build_clean_tower();          // Purge the old mix after a tool change
   #endif
 
   // Used in Stepper
@@ -347,6 +363,39 @@ class Mixer {
     }
   }
 
+  #if ENABLED(LIN_ADVANCE)
+    /**
+     * Share out pending E steps (extrusion and advance) between the mixing
+     * steppers. Each step adds the mix to every stepper's error and goes to
+     * the one furthest behind (or ahead, when retracting), so every input
+     * stays within two steps of its share in both directions. Up to one
+     * step per stepper is taken for a single pulse.
+     *
+     * Return a bitmask of the steppers to pulse and reduce 'steps' to match.
+     */
+    FORCE_INLINE static uint8_t get_next_steppers(int8_t &steps) {
+      const bool forward = steps > 0;
+      uint8_t mask = 0;
+      for (uint8_t n = ABS(steps); n--;) {
+        int8_t pick = -1;
+        MIXER_STEPPER_LOOP(j) {
+          if (forward) la_err[j] += s_color[j]; else la_err[j] -= s_color[j];
+          if (s_color[j] && !TEST(mask, j)
+            && (pick < 0 || (forward ? la_err[j] > la_err[pick] : la_err[j] < la_err[pick]))
+          ) pick = j;
+        }
+        // Leave the rest for the next pulse if no free stepper is behind
+        if (pick < 0 || (forward ? la_err[pick] <= 0 : la_err[pick] >= 0)) {
+          MIXER_STEPPER_LOOP(j) if (forward) la_err[j] -= s_color[j]; else la_err[j] += s_color[j];
+          break;
+        }
+        if (forward) { la_err[pick] -= s_total; steps--; } else { la_err[pick] += s_total; steps++; }
+        SBI(mask, pick);
+      }
+      return mask;
+    }
+  #endif
+
   
   
   private:
@@ -358,6 +407,9 @@ class Mixer {
   static int_fast8_t  runner;
   static mixer_comp_t s_color[MIXING_STEPPERS];
   static mixer_accu_t accu[MIXING_STEPPERS];
+  #if ENABLED(LIN_ADVANCE)
+    static int32_t s_total, la_err[MIXING_STEPPERS];
+  #endif
 
 };
 
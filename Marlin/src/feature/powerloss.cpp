@@ -38,7 +38,7 @@ job_recovery_info_t PrintJobRecovery::info;
 const char PrintJobRecovery::filename[5] = "/PLR";
 uint8_t PrintJobRecovery::queue_index_r;
 uint32_t PrintJobRecovery::cmd_sdpos, // = 0
-         PrintJobRecovery::sdpos[BUFSIZE];
+         PrintJobRecovery::sdpos[CMD_QUEUE_SLOTS];
 
 #if HAS_DWIN_LCD
   #include "../lcd/dwin/dwin_ui/dwin.h"
@@ -173,7 +173,7 @@ class PrintJobRecovery {
 
     static uint8_t queue_index_r;     //!< Queue index of the active command
     static uint32_t cmd_sdpos,        //!< SD position of the next command
-                    sdpos[BUFSIZE];   //!< SD positions of queued commands
+                    sdpos[CMD_QUEUE_SLOTS]; //!< SD positions of queued commands
 
     #if HAS_DWIN_LCD
       static bool dwin_flag;
@@ -0,0 +1,148 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Preheat Scheduler
+ *
+ * At the start of a job M190 and M109 set their targets and return at once.
+ * Homing and probing proceed while the heaters come up, with the hotend held
+ * at a probe-safe standby until the mesh is done. The deferred waits are done
+ * just before the first extruding move (or by M116).
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PREHEAT_SCHEDULER)
+
+#include "preheat_scheduler.h"
+#include "../module/temperature.h"
+#include "../lcd/ultralcd.h"
+#include "../MarlinCore.h" // for wait_for_heatup, idle
+
+PreheatScheduler preheat;
+
+bool PreheatScheduler::deferring, // = false
+     PreheatScheduler::probed;
+uint8_t PreheatScheduler::hotend_held,
+        PreheatScheduler::hotend_waiting,
+        PreheatScheduler::hotend_no_cooling;
+int16_t PreheatScheduler::hotend_target[HOTENDS];
+#if HAS_HEATED_BED
+  bool PreheatScheduler::bed_waiting,
+       PreheatScheduler::bed_no_cooling;
+#endif
+
+void PreheatScheduler::reset() {
+  deferring = probed = false;
+  hotend_held = hotend_waiting = hotend_no_cooling = 0;
+  TERN_(HAS_HEATED_BED, bed_waiting = bed_no_cooling = false);
+}
+
+// Put the hotends back to their full targets
+void PreheatScheduler::restore_hotends() {
+  HOTEND_LOOP()
+    if (TEST(hotend_held, e) && thermalManager.degTargetHotend(e) != hotend_target[e])
+      thermalManager.setTargetHotend(hotend_target[e], e);
+  probed = true;
+}
+
+// Stop deferring without waiting
+void PreheatScheduler::release() {
+  if (deferring) restore_hotends();
+  reset();
+}
+
+#if HAS_HEATED_BED
+
+  bool PreheatScheduler::defer_bed(const bool no_wait_for_cooling) {
+    if (!deferring) return false;
+    bed_waiting = true;
+    bed_no_cooling = no_wait_for_cooling;
+    return true;
+  }
+
+  #ifdef PREHEAT_PROBE_BED_WINDOW
+
+    // Let the bed get close enough to its target for a representative mesh
+    void PreheatScheduler::probing_wait_for_bed() {
+      if (!deferring || !bed_waiting) return;
+      const int16_t min_temp = thermalManager.degTargetBed() - (PREHEAT_PROBE_BED_WINDOW);
+      if (thermalManager.degBed() >= min_temp) return;
+      ui.set_status_P(GET_TEXT(MSG_BED_HEATING));
+      wait_for_heatup = true;
+      while (wait_for_heatup && thermalManager.degBed() < min_temp) idle();
+      wait_for_heatup = false;
+    }
+
+  #endif
+
+#endif // HAS_HEATED_BED
+
+/**
+ * Record a hotend target set by M104 / M109 while deferring.
+ * Until probing is done the heater is limited to the standby temperature.
+ */
+bool PreheatScheduler::defer_hotend(const uint8_t e, const int16_t celsius, const bool wait, const bool no_wait_for_cooling) {
+  if (!deferring) return false;
+  hotend_target[e] = celsius;
+  SBI(hotend_held, e);
+  if (wait) {
+    SBI(hotend_waiting, e);
+    SET_BIT_TO(hotend_no_cooling, e, no_wait_for_cooling);
+  }
+  if (!probed && celsius > (PREHEAT_PROBE_STANDBY_TEMP))
+    thermalManager.setTargetHotend(PREHEAT_PROBE_STANDBY_TEMP, e);
+  return true;
+}
+
+// The mesh is done. Bring the hotends up to temperature while the rest of the start code runs.
+void PreheatScheduler::probing_done() {
+  if (deferring) restore_hotends();
+}
+
+// Do all the deferred waits. Everything is already heating, so this is usually short.
+void PreheatScheduler::wait_for_heaters() {
+  const uint8_t waiting = hotend_waiting, no_cooling = hotend_no_cooling;
+  #if HAS_HEATED_BED
+    const bool wait_bed = bed_waiting, bed_nwc = bed_no_cooling;
+  #endif
+
+  release();
+
+  #if HAS_HEATED_BED
+    if (wait_bed) {
+      ui.set_status_P(thermalManager.isHeatingBed() ? GET_TEXT(MSG_BED_HEATING) : GET_TEXT(MSG_BED_COOLING));
+      thermalManager.wait_for_bed(bed_nwc);
+    }
+  #endif
+
+  #if HAS_TEMP_HOTEND
+    HOTEND_LOOP() if (TEST(waiting, e)) {
+      TERN_(HAS_DISPLAY, thermalManager.set_heating_message(e));
+      (void)thermalManager.wait_for_hotend(e, TEST(no_cooling, e));
+    }
+  #else
+    UNUSED(waiting); UNUSED(no_cooling);
+  #endif
+}
+
+#endif // PREHEAT_SCHEDULER
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/preheat_scheduler.h - Overlap heat-up with homing and probing
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class PreheatScheduler {
+public:
+  static bool deferring;                  // M190 / M109 don't block until the first extrusion
+
+  static inline void enable(const bool onoff) { if (onoff) deferring = true; else release(); }
+  static void reset();
+  static void release();
+
+  #if HAS_HEATED_BED
+    static bool defer_bed(const bool no_wait_for_cooling);
+    #ifdef PREHEAT_PROBE_BED_WINDOW
+      static void probing_wait_for_bed();
+    #endif
+  #endif
+
+  static bool defer_hotend(const uint8_t e, const int16_t celsius, const bool wait, const bool no_wait_for_cooling);
+  static void probing_done();
+
+  static void wait_for_heaters();
+
+  // Called for each move that would extrude
+  static inline void check_extrusion() { if (deferring) wait_for_heaters(); }
+
+private:
+  static bool probed;                     // Hotends may go to their full targets
+  static uint8_t hotend_held, hotend_waiting, hotend_no_cooling;
+  static int16_t hotend_target[HOTENDS];
+  #if HAS_HEATED_BED
+    static bool bed_waiting, bed_no_cooling;
+  #endif
+
+  static void restore_hotends();
+};
+
+extern PreheatScheduler preheat;
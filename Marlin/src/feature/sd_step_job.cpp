@@ -0,0 +1,194 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/sd_step_job.cpp - Print direct stepping pages from SD
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(DIRECT_STEPPING_SD)
+
+#include "sd_step_job.h"
+
+#include "../sd/cardreader.h"
+#include "../module/planner.h"
+#include "../module/motion.h"
+
+SDStepJob sd_step_job;
+
+heatshrink_decoder SDStepJob::hsd;
+SDStepJob::JobState SDStepJob::state; // = JOB_NONE
+bool SDStepJob::page_claimed;
+uint32_t SDStepJob::pages_left, SDStepJob::file_pos;
+page_idx_t SDStepJob::page_idx;
+uint8_t SDStepJob::head[RECORD_HEADER_SIZE];
+uint16_t SDStepJob::record_bytes;
+uint8_t SDStepJob::in_buf[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE], SDStepJob::in_len, SDStepJob::in_pos;
+
+static inline uint16_t get_u16(const uint8_t * const b) { return b[0] | (b[1] << 8); }
+static inline uint32_t get_u32(const uint8_t * const b) { return get_u16(b) | (uint32_t(get_u16(b + 2)) << 16); }
+
+void SDStepJob::open() {
+  // Any earlier job is over
+  state = JOB_NONE;
+  page_claimed = false;
+  page_manager.local = false;
+
+  uint8_t h[HEADER_SIZE];
+  if (card.read(h, HEADER_SIZE) != HEADER_SIZE || strncmp_P((char*)h, PSTR("MSTP"), 4)) {
+    card.setIndex(0);                     // Not a step job. Read it as G-code.
+    return;
+  }
+
+  state = JOB_RUNNING;
+
+  if (h[4] != VERSION
+    || h[5] != STEPPER_PAGE_FORMAT
+    || h[6] != HEATSHRINK_STATIC_WINDOW_BITS
+    || h[7] != HEATSHRINK_STATIC_LOOKAHEAD_BITS
+    || get_u16(&h[8]) != DirectStepping::Config::PAGE_SIZE
+  ) return fail(PSTR("Step job doesn't match this firmware"));
+
+  pages_left = get_u32(&h[12]);
+  record_bytes = in_len = in_pos = 0;
+  heatshrink_decoder_reset(&hsd);
+
+  card.setIndex(HEADER_SIZE);
+  file_pos = HEADER_SIZE;
+
+  // Pages from an aborted job are still held
+  if (!planner.has_blocks_queued()) page_manager.init();
+  page_manager.local = true;
+}
+
+void SDStepJob::service() {
+  if (state != JOB_RUNNING) return;
+
+  // The compressed stream can only be read from where it left off
+  if (card.getIndex() != file_pos) return fail(PSTR("Step job can't resume here"));
+
+  // Queue two pages at most per call, keeping the loop responsive
+  LOOP_L_N(i, 2) {
+    if (!pages_left) return finish();
+    if (!planner.moves_free()) return;
+    if (!page_claimed) {
+      if (!page_manager.claim_page(page_idx)) return;
+      page_claimed = true;
+    }
+
+    if (!decode_record()) return;
+
+    const uint32_t rate = get_u32(&head[0]);
+    const uint16_t steps = get_u16(&head[4]);
+    if (!rate || steps > DirectStepping::Config::TOTAL_STEPS) return fail(PSTR("Bad step job page"));
+
+    planner.last_page_step_rate = rate;
+    LOOP_XYZE(a) planner.last_page_dir[a] = TEST(head[6], a);
+
+    page_manager.commit_page(page_idx);
+    page_claimed = false;
+    record_bytes = 0;
+    pages_left--;
+
+    planner.buffer_page(page_idx, 0, steps);
+  }
+}
+
+/**
+ * Decode the rest of a record into 'head' and the claimed page, reading
+ * from SD as needed. Return false if the job had to be stopped.
+ */
+bool SDStepJob::decode_record() {
+  constexpr uint16_t record_size = RECORD_HEADER_SIZE + DirectStepping::Config::PAGE_SIZE;
+  uint8_t * const page = page_manager.get_page(page_idx);
+
+  while (record_bytes < record_size) {
+    uint8_t *dst;
+    size_t want, got;
+    if (record_bytes < RECORD_HEADER_SIZE) {
+      dst = &head[record_bytes];
+      want = RECORD_HEADER_SIZE - record_bytes;
+    }
+    else {
+      dst = &page[record_bytes - RECORD_HEADER_SIZE];
+      want = record_size - record_bytes;
+    }
+
+    if (heatshrink_decoder_poll(&hsd, dst, want, &got) < 0) {
+      fail(PSTR("Bad step job data"));
+      return false;
+    }
+    record_bytes += got;
+    if (got) continue;
+
+    // The decoder needs more input
+    if (in_pos >= in_len) {
+      in_len = in_pos = 0;
+      while (in_len < sizeof(in_buf)) {
+        const int16_t c = card.get();
+        if (c < 0) break;
+        in_buf[in_len++] = c;
+      }
+      file_pos = card.getIndex();
+      if (!in_len) {
+        fail(PSTR("Step job ended early"));
+        return false;
+      }
+    }
+
+    size_t sunk;
+    heatshrink_decoder_sink(&hsd, &in_buf[in_pos], in_len - in_pos, &sunk);
+    in_pos += sunk;
+  }
+
+  return true;
+}
+
+void SDStepJob::finish() {
+  state = JOB_NONE;
+  planner.synchronize();
+  page_manager.local = false;
+
+  // The pages moved the steppers without the planner
+  set_current_from_steppers_for_axis(ALL_AXES);
+  sync_plan_position();
+
+  card.fileHasFinished();
+}
+
+void SDStepJob::fail(PGM_P const msg) {
+  state = JOB_FAILED;                     // Until the print is aborted
+  if (page_claimed) {
+    page_manager.free_page(page_idx);
+    page_claimed = false;
+  }
+  page_manager.local = false;
+
+  SERIAL_ERROR_START();
+  serialprintPGM(msg);
+  SERIAL_EOL();
+
+  card.flag.abort_sd_printing = true;
+}
+
+#endif // DIRECT_STEPPING_SD
@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/sd_step_job.h - Print direct stepping pages from SD
+ *
+ * A step job file starts with a plain 16-byte header:
+ *
+ *   0  "MSTP"
+ *   4  Version (1)
+ *   5  Page format (STEPPER_PAGE_FORMAT)
+ *   6  heatshrink window bits
+ *   7  heatshrink lookahead bits
+ *   8  Page size (uint16)
+ *  10  Reserved
+ *  12  Page count (uint32)
+ *
+ * The rest is one heatshrink stream of page records. Each record holds
+ * the step rate (uint32), the number of steps (uint16), the direction
+ * bits for X Y Z E (uint8, set for forward) and then the page itself,
+ * the same as G6 R S X Y Z E and a page sent over serial.
+ *
+ * All values are little-endian.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#include "direct_stepping.h"
+#include "../libs/heatshrink/heatshrink_decoder.h"
+
+class SDStepJob {
+public:
+  static constexpr uint8_t VERSION = 1,
+                           HEADER_SIZE = 16,
+                           RECORD_HEADER_SIZE = 7;
+
+  // Check the file just opened for printing, and take it over if it's a step job
+  static void open();
+
+  // The open file is a step job, even one that failed, so it isn't read as G-code
+  static inline bool active() { return state != JOB_NONE; }
+
+  // Decode and queue pages while there are free pages and blocks
+  static void service();
+
+private:
+  static heatshrink_decoder hsd;
+  enum JobState : uint8_t { JOB_NONE, JOB_RUNNING, JOB_FAILED };
+  static JobState state;
+  static bool page_claimed;
+  static uint32_t pages_left;             // Records not yet queued
+  static uint32_t file_pos;               // Where the next input byte is read
+  static page_idx_t page_idx;
+  static uint8_t head[RECORD_HEADER_SIZE];
+  static uint16_t record_bytes;           // Bytes of the current record decoded so far
+  static uint8_t in_buf[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE], in_len, in_pos;
+
+  static bool decode_record();
+  static void finish();
+  static void fail(PGM_P const msg);
+};
+
+extern SDStepJob sd_step_job;
@@ -0,0 +1,251 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/telemetry.cpp - Framed binary status stream, one subscription per serial port
+ *
+ * A sample is staged into the port's buffer only after the previous one has
+ * been sent. Whole frames are handed to the serial driver only when its TX
+ * buffer can take them, so text replies on the same port are never split.
+ * Samples that can't be staged are dropped and show up as gaps in 'seq'.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "telemetry.h"
+#include "../libs/crc16.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../module/temperature.h"
+#include "../module/printcounter.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+#if ENABLED(MIXING_EXTRUDER)
+  #include "mixing.h"
+#endif
+
+Telemetry telemetry;
+
+Telemetry::subscriber_t Telemetry::sub[NUM_SERIAL];
+
+#define TLM_HEADER_SIZE 6   // A5 5A ver type seq len
+#define TLM_FRAME_SIZE(L) (TLM_HEADER_SIZE + (L) + 2)
+
+/**
+ * Append frames to a subscriber buffer. Overflow marks the sample as bad
+ * instead of writing past the end.
+ */
+class FrameWriter {
+  public:
+    FrameWriter(uint8_t * const b, const uint16_t p, const uint8_t q) : buf(b), pos(p), seq(q), ok(true) {}
+
+    void begin(const Telemetry::RecordType type) {
+      start = pos;
+      put8(0xA5); put8(0x5A); put8(TELEMETRY_VERSION); put8(type); put8(seq); put8(0);
+    }
+
+    void end() {
+      if (!ok) return;
+      buf[start + 5] = uint8_t(pos - start - (TLM_HEADER_SIZE));
+      uint16_t crc = 0xFFFF;
+      crc16(&crc, &buf[start + 2], pos - start - 2);
+      put16(crc);
+    }
+
+    void put8(const uint8_t v) { if (pos < TELEMETRY_BUFFER_SIZE) buf[pos++] = v; else ok = false; }
+    void put16(const uint16_t v) { put8(v & 0xFF); put8(v >> 8); }
+    void put32(const uint32_t v) { put16(v & 0xFFFF); put16(v >> 16); }
+
+    uint8_t *buf;
+    uint16_t pos, start;
+    uint8_t seq;
+    bool ok;
+};
+
+// Ports that can report free TX space are never written past it.
+// Others (e.g., USB CDC on STM32F1) are trusted with TELEMETRY_TX_CHUNK bytes
+// per call, and a write may wait there if the host stops reading.
+template<typename S> static auto _tx_space(S &s, int) -> decltype(s.availableForWrite()) { return s.availableForWrite(); }
+template<typename S> static int _tx_space(S &, long) { return TELEMETRY_TX_CHUNK; }
+
+static int tx_space(const uint8_t port) {
+  switch (port) {
+    case 0: return _tx_space(MYSERIAL0, 0);
+    #if HAS_MULTI_SERIAL
+      #if HAS_MYSERIAL1 && HAS_WIFI_SERIAL
+        case 1: return _tx_space(MYSERIAL1, 0);
+        case 2: return _tx_space(WIFI_SERIAL, 0);
+      #elif HAS_MYSERIAL1
+        case 1: return _tx_space(MYSERIAL1, 0);
+      #elif HAS_WIFI_SERIAL
+        case 1: return _tx_space(WIFI_SERIAL, 0);
+      #endif
+    #endif
+    default: return 0;
+  }
+}
+
+static void tx_write(const uint8_t port, const uint8_t * const data, const uint16_t len) {
+  switch (port) {
+    case 0: MYSERIAL0.write(data, len); break;
+    #if HAS_MULTI_SERIAL
+      #if HAS_MYSERIAL1 && HAS_WIFI_SERIAL
+        case 1: MYSERIAL1.write(data, len); break;
+        case 2: WIFI_SERIAL.write(data, len); break;
+      #elif HAS_MYSERIAL1
+        case 1: MYSERIAL1.write(data, len); break;
+      #elif HAS_WIFI_SERIAL
+        case 1: WIFI_SERIAL.write(data, len); break;
+      #endif
+    #endif
+    default: break;
+  }
+}
+
+void Telemetry::subscribe(const uint8_t port, const uint8_t hz, const uint8_t mask) {
+  if (port >= NUM_SERIAL) return;
+  subscriber_t &s = sub[port];
+  s.hz = _MIN(hz, TELEMETRY_MAX_RATE);
+  s.mask = mask & all_records;
+  s.head = s.tail = 0;
+  s.next_ms = millis();
+}
+
+void Telemetry::report(const uint8_t port) {
+  if (port >= NUM_SERIAL) return;
+  SERIAL_ECHOLNPAIR("M156 P", int(port), " S", int(sub[port].hz), " R", int(sub[port].mask));
+}
+
+/**
+ * Build one sample (a frame per selected record) from the current state.
+ * Values are copied as scaled integers so no float formatting is done.
+ */
+bool Telemetry::stage(subscriber_t &s, const millis_t ms) {
+  FrameWriter w(s.buffer, 0, s.seq);
+
+  #if HAS_TEMP_SENSOR
+    if (TEST(s.mask, TLM_TEMPS)) {
+      w.begin(TLM_TEMPS);
+      w.put32(ms);
+      HOTEND_LOOP() {
+        w.put16(int16_t(thermalManager.degHotend(e) * 10));
+        w.put16(thermalManager.degTargetHotend(e));
+        w.put8(_MIN(thermalManager.getHeaterPower(heater_id_t(e)), 255));
+      }
+      #if HAS_HEATED_BED
+        w.put16(int16_t(thermalManager.degBed() * 10));
+        w.put16(thermalManager.degTargetBed());
+        w.put8(_MIN(thermalManager.getHeaterPower(H_BED), 255));
+      #endif
+      w.end();
+    }
+  #endif
+
+  if (TEST(s.mask, TLM_MOTION)) {
+    w.begin(TLM_MOTION);
+    w.put32(ms);
+    w.put8(planner.movesplanned());
+    w.put8(BLOCK_BUFFER_SIZE);
+    LOOP_XYZE(i) w.put32(stepper.position(AxisEnum(i)));
+    w.put16(feedrate_percentage);
+    w.end();
+  }
+
+  if (TEST(s.mask, TLM_JOB)) {
+    w.begin(TLM_JOB);
+    w.put32(ms);
+    #if ENABLED(SDSUPPORT)
+      const bool open = card.isFileOpen();
+      w.put8(  (card.isPrinting() ? _BV(0) : 0)
+             | (card.isPaused() ? _BV(1) : 0)
+             | (print_job_timer.isRunning() ? _BV(2) : 0) );
+      w.put32(open ? card.getIndex() : 0);
+      w.put32(open ? card.getFileSize() : 0);
+    #else
+      w.put8(print_job_timer.isRunning() ? _BV(2) : 0);
+      w.put32(0);
+      w.put32(0);
+    #endif
+    w.put32(print_job_timer.duration());
+    w.end();
+  }
+
+  #if ENABLED(MIXING_EXTRUDER)
+    if (TEST(s.mask, TLM_MIX)) {
+      const uint8_t vtool = mixer.get_current_vtool();
+      const mixer_comp_t * const color = mixer.color[vtool];
+      uint32_t total = 0;
+      MIXER_STEPPER_LOOP(i) total += color[i];
+      w.begin(TLM_MIX);
+      w.put8(vtool);
+      MIXER_STEPPER_LOOP(i) w.put8(total ? uint8_t((uint32_t(color[i]) * 100 + total / 2) / total) : 0);
+      w.end();
+    }
+  #endif
+
+  #if HAS_FAN
+    if (TEST(s.mask, TLM_FANS)) {
+      w.begin(TLM_FANS);
+      LOOP_L_N(f, FAN_COUNT) w.put8(thermalManager.fan_speed[f]);
+      w.end();
+    }
+  #endif
+
+  if (!w.ok) return false;
+  s.tail = 0;
+  s.head = w.pos;
+  return true;
+}
+
+// Send as many whole frames as the port's TX buffer can take right now
+void Telemetry::flush(const uint8_t port, subscriber_t &s) {
+  int space = tx_space(port);
+  while (s.tail < s.head) {
+    const uint16_t len = TLM_FRAME_SIZE(s.buffer[s.tail + 5]);
+    if (space < int(len)) break;
+    tx_write(port, &s.buffer[s.tail], len);
+    s.tail += len;
+    space -= len;
+  }
+}
+
+void Telemetry::idle() {
+  const millis_t ms = millis();
+  LOOP_L_N(p, NUM_SERIAL) {
+    subscriber_t &s = sub[p];
+    if (!s.hz) continue;
+    if (ELAPSED(ms, s.next_ms)) {
+      s.next_ms = ms + 1000UL / s.hz;
+      if (s.tail >= s.head) stage(s, ms);   // Previous sample sent? Take a new one.
+      s.seq++;                              // Skipped samples leave a gap
+    }
+    flush(p, s);
+  }
+}
+
+#endif // BINARY_TELEMETRY
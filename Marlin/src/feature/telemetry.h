@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/telemetry.h - Framed binary status stream, one subscription per serial port
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define TELEMETRY_VERSION 1
+
+class Telemetry {
+public:
+  enum RecordType : uint8_t {
+    TLM_TEMPS,      // ms, then per heater: int16 celsius x10, int16 target, uint8 power
+    TLM_MOTION,     // ms, uint8 moves planned, uint8 queue size, int32 steps[XYZE], int16 feedrate %
+    TLM_JOB,        // ms, uint8 flags, uint32 SD position, uint32 file size, uint32 elapsed seconds
+    TLM_MIX,        // uint8 vtool, uint8 percent[MIXING_STEPPERS]
+    TLM_FANS,       // uint8 speed[FAN_COUNT]
+    TLM_COUNT
+  };
+
+  static constexpr uint8_t all_records = _BV(TLM_COUNT) - 1;
+
+  static void subscribe(const uint8_t port, const uint8_t hz, const uint8_t mask);
+  static void report(const uint8_t port);
+  static void idle();
+
+private:
+  typedef struct {
+    uint8_t hz, mask, seq;
+    millis_t next_ms;
+    uint16_t head, tail;                        // Staged bytes still to send are [tail, head)
+    uint8_t buffer[TELEMETRY_BUFFER_SIZE];
+  } subscriber_t;
+
+  static subscriber_t sub[NUM_SERIAL];
+
+  static bool stage(subscriber_t &s, const millis_t ms);
+  static void flush(const uint8_t port, subscriber_t &s);
+};
+
+extern Telemetry telemetry;
@@ -72,17 +72,33 @@
   #include "../../../module/tool_change.h"
 #endif
 
+#if ENABLED(PREHEAT_SCHEDULER)
+  #include "../../../feature/preheat_scheduler.h"
+#endif
+
+#if BOTH(ADAPTIVE_MESH_PROBING, SDSUPPORT)
+  #include "../../../sd/cardreader.h"
+#endif
+
+#if BOTH(ADAPTIVE_MESH_PROBING, JOB_ANALYZER)
+  #include "../../../feature/job_analyzer.h"
+#endif
+
 #if ABL_GRID
   #if ENABLED(PROBE_Y_FIRST)
     #define PR_OUTER_VAR meshCount.x
     #define PR_OUTER_END abl_grid_points.x
+    #define PR_OUTER_AXIS X_AXIS
     #define PR_INNER_VAR meshCount.y
     #define PR_INNER_END abl_grid_points.y
+    #define PR_INNER_AXIS Y_AXIS
   #else
     #define PR_OUTER_VAR meshCount.y
     #define PR_OUTER_END abl_grid_points.y
+    #define PR_OUTER_AXIS Y_AXIS
     #define PR_INNER_VAR meshCount.x
     #define PR_INNER_END abl_grid_points.x
+    #define PR_INNER_AXIS X_AXIS
   #endif
 #endif
 
@@ -146,6 +162,13 @@
  *
  *  Z  Supply an additional Z probe offset
  *
+ * Parameters with ADAPTIVE_MESH_PROBING only:
+ *
+ *  A  Probe a mesh over the print area only, at most ADAPTIVE_MESH_SPACING
+ *     apart. It becomes the active mesh, held level with its edges beyond.
+ *     L/R/F/B (or H) give the part bounds, otherwise the extruding moves of
+ *     the open SD file are scanned. The adaptive mesh is not saved to EEPROM.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -222,15 +245,22 @@ G29_TYPE GcodeSuite::G29() {
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       ABL_VAR bool do_topography_map;
       ABL_VAR xy_uint8_t abl_grid_points;
+    #elif ENABLED(ADAPTIVE_MESH_PROBING)
+      ABL_VAR xy_uint8_t abl_grid_points;
     #else // Bilinear		        		  
 			constexpr xy_uint8_t abl_grid_points = { GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y };
     #endif
 
-    #if ENABLED(AUTO_BED_LEVELING_LINEAR)
+    #if EITHER(AUTO_BED_LEVELING_LINEAR, ADAPTIVE_MESH_PROBING)
       ABL_VAR int abl_points;
     #else						
 			int constexpr abl_points = GRID_MAX_POINTS;			
     #endif
+
+    #if ENABLED(ADAPTIVE_MESH_PROBING)
+      ABL_VAR bool adaptive;
+      const millis_t probe_start_ms = millis();
+    #endif
 		
     #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
       ABL_VAR float zoffset = 0.0;
@@ -390,6 +420,60 @@ G29_TYPE GcodeSuite::G29() {
         );
       }
 
+      #if ENABLED(ADAPTIVE_MESH_PROBING)
+
+        abl_grid_points.set(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y);
+
+        adaptive = parser.seen('A');
+        if (adaptive) {
+          // Part bounds from parameters or from the open print file
+          const bool seen_area = parser.seen('H') || parser.seen('L') || parser.seen('R') || parser.seen('F') || parser.seen('B');
+          if (!seen_area) {
+            #if ENABLED(SDSUPPORT)
+              adaptive = TERN0(JOB_ANALYZER, job_analyzer.printArea(probe_position_lf, probe_position_rb))
+                      || card.scanPrintArea(probe_position_lf, probe_position_rb);
+              if (adaptive) {
+                probe_position_lf.set(RAW_X_POSITION(probe_position_lf.x), RAW_Y_POSITION(probe_position_lf.y));
+                probe_position_rb.set(RAW_X_POSITION(probe_position_rb.x), RAW_Y_POSITION(probe_position_rb.y));
+              }
+            #else
+              adaptive = false;
+            #endif
+            if (!adaptive) {
+              SERIAL_ECHOLNPGM("?Print area unknown. Probing the full grid.");
+              probe_position_lf.set(x_min, y_min);
+              probe_position_rb.set(x_max, y_max);
+            }
+          }
+        }
+
+        if (adaptive) {
+          // Add the margin, stay within reach, and keep at least one cell
+          auto fit_axis = [](float &lo, float &hi, const float mn, const float mx) -> uint8_t {
+            lo = _MAX(lo - (ADAPTIVE_MESH_MARGIN), mn);
+            hi = _MIN(hi + (ADAPTIVE_MESH_MARGIN), mx);
+            if (hi - lo < ADAPTIVE_MESH_SPACING) {
+              const float mid = (lo + hi) * 0.5f;
+              lo = _MAX(mid - (ADAPTIVE_MESH_SPACING) * 0.5f, mn);
+              hi = _MIN(lo + (ADAPTIVE_MESH_SPACING), mx);
+              lo = _MAX(hi - (ADAPTIVE_MESH_SPACING), mn);
+            }
+            return uint8_t(ceil((hi - lo) / (ADAPTIVE_MESH_SPACING))) + 1;
+          };
+          abl_grid_points.set(
+            _MIN(fit_axis(probe_position_lf.x, probe_position_rb.x, x_min, x_max), GRID_MAX_POINTS_X),
+            _MIN(fit_axis(probe_position_lf.y, probe_position_rb.y, y_min, y_max), GRID_MAX_POINTS_Y)
+          );
+          NOLESS(abl_grid_points.x, 2);
+          NOLESS(abl_grid_points.y, 2);
+          if (verbose_level) SERIAL_ECHOLNPAIR("Adaptive area X", probe_position_lf.x, ":", probe_position_rb.x,
+                                               " Y", probe_position_lf.y, ":", probe_position_rb.y);
+        }
+
+        abl_points = abl_grid_points.x * abl_grid_points.y;
+
+      #endif // ADAPTIVE_MESH_PROBING
+
       if (!probe.good_bounds(probe_position_lf, probe_position_rb)) {
         SERIAL_ECHOLNPGM("? (L,R,F,B) out of bounds.");
         G29_RETURN(false);
@@ -409,6 +493,10 @@ G29_TYPE GcodeSuite::G29() {
 
     planner.synchronize();
 
+    #if BOTH(PREHEAT_SCHEDULER, HAS_HEATED_BED) && defined(PREHEAT_PROBE_BED_WINDOW)
+      if (!faux) preheat.probing_wait_for_bed();
+    #endif
+
     if (!faux) remember_feedrate_scaling_off();
 
     // Disable auto bed leveling during G29.
@@ -663,15 +751,28 @@ G29_TYPE GcodeSuite::G29() {
 	else	
   #endif
   {	
-    bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
     measured_z = 0;		
     xy_int8_t meshCount;
 
+    #if ENABLED(FAST_MESH_PROBING)
+      // Start at the grid corner nearest the probe
+      const bool fast_mesh = !faux && raise_after != PROBE_PT_STOW;
+      xy_pos_t probe_xy = current_position;
+      probe_xy += probe.offset_xy;
+      const bool outer_rev = probe_xy[PR_OUTER_AXIS] > (probe_position_lf[PR_OUTER_AXIS] + probe_position_rb[PR_OUTER_AXIS]) * 0.5f;
+      bool zig = probe_xy[PR_INNER_AXIS] <= (probe_position_lf[PR_INNER_AXIS] + probe_position_rb[PR_INNER_AXIS]) * 0.5f;
+      if (fast_mesh) probe.fast_mesh_start();
+    #else
+      constexpr bool outer_rev = false;
+      bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
+    #endif
+
 		TERN_(HAS_DWIN_LCD,DWIN_G29_Show_Messge(G29_MESH_READY));
 
     // Outer loop is X with PROBE_Y_FIRST enabled
     // Outer loop is Y with PROBE_Y_FIRST disabled
-    for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
+    for (uint8_t outer = 0; outer < PR_OUTER_END && !isnan(measured_z); outer++) {
+      PR_OUTER_VAR = outer_rev ? PR_OUTER_END - 1 - outer : outer;
       int8_t inStart, inStop, inInc;
       if (zig) {                    // Zig away from origin
         inStart = 0;                // Left or front
@@ -685,7 +786,7 @@ G29_TYPE GcodeSuite::G29() {
       }
       zig ^= true; // zag
       // An index to print current state
-      uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_END) + 1;
+      uint8_t pt_index = outer * (PR_INNER_END) + 1;
       // Inner loop is Y with PROBE_Y_FIRST enabled
       // Inner loop is X with PROBE_Y_FIRST disabled
       for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
@@ -718,7 +819,11 @@ G29_TYPE GcodeSuite::G29() {
 				}
 				measured_z = sum_z/m;
 				#else
-	        measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
+	        measured_z = faux ? 0.001f * random(-100, 101)
+	          #if ENABLED(FAST_MESH_PROBING)
+	            : fast_mesh ? probe.probe_mesh_point(probePos, verbose_level)
+	          #endif
+	          : probe.probe_at_point(probePos, raise_after, verbose_level);
 	        if (isnan(measured_z)) {
 	          set_bed_leveling_enabled(abl_should_enable);
 	          break; // Breaks out of both loops
@@ -752,6 +857,9 @@ G29_TYPE GcodeSuite::G29() {
 
       } // inner
     } // outer
+
+    TERN_(FAST_MESH_PROBING, if (fast_mesh) probe.fast_mesh_finish());
+
   #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
     // Probe at 3 arbitrary points
@@ -812,6 +920,14 @@ G29_TYPE GcodeSuite::G29() {
   if (!isnan(measured_z)) {
     #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
+      #if ENABLED(ADAPTIVE_MESH_PROBING)
+        if (adaptive) {
+          // Fill the unprobed rows and columns past the print area
+          extend_bed_level(abl_grid_points);
+          SERIAL_ECHOLNPAIR("Adaptive mesh: ", abl_points, " points in ", (millis() - probe_start_ms) / 1000, "s");
+        }
+      #endif
+
       if (!dryrun) extrapolate_unprobed_bed_level();
       print_bilinear_leveling_grid();
 
@@ -935,7 +1051,7 @@ G29_TYPE GcodeSuite::G29() {
         if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("G29 uncorrected Z:", current_position.z);
 				
 				#ifdef EEPROM_SETTINGS
-				settings.save();				
+				if (TERN1(ADAPTIVE_MESH_PROBING, !adaptive)) settings.save(); // Adaptive meshes are for one print
 				#endif
 
         // Unapply the offset because it is going to be immediately applied
@@ -951,6 +1067,9 @@ G29_TYPE GcodeSuite::G29() {
 
     // Auto Bed Leveling is complete! Enable if possible.
     planner.leveling_active = dryrun ? abl_should_enable : true;
+
+    // Let the hotend leave its probing standby temperature
+    TERN_(PREHEAT_SCHEDULER, preheat.probing_done());
   } // !isnan(measured_z)
 
   // Restore state after probing
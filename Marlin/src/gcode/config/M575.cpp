@@ -47,10 +47,14 @@ void GcodeSuite::M575() {
     case   38: baud = 38400; break;
     case   57: baud = 57600; break;
     case  115: baud = 115200; break;
+    case  230: baud = 230400; break;
+    case  460: baud = 460800; break;
+    case  921: baud = 921600; break;
   }
   switch (baud) {
     case 2400: case 9600: case 19200: case 38400: case 57600:
-    case 115200: case 250000: case 500000: case 1000000: {
+    case 115200: case 230400: case 250000: case 460800: case 500000:
+    case 921600: case 1000000: {
       const int8_t port = parser.intval('P', -99);
       const bool set0 = (port == -99 || port == 0);
       if (set0) SERIAL_ECHO_MSG(" Serial ", '0', " baud rate set to ", baud);
@@ -58,7 +62,7 @@ void GcodeSuite::M575() {
         const bool set1 = (port == -99 || port == 1);
         if (set1) SERIAL_ECHO_MSG(" Serial ", '1', " baud rate set to ", baud);
 				const bool set2 = (port == -99 || port == 2);
-        if (set2) SERIAL_ECHO_MSG(" Serial ",'2' " baud rate set to ", baud);
+        if (set2) SERIAL_ECHO_MSG(" Serial ", '2', " baud rate set to ", baud);
       #endif
 
       SERIAL_FLUSH();
@@ -39,6 +39,7 @@
  *  K<factor>   Set current advance K factor (Slot 0).
  *  L<factor>   Set secondary advance K factor (Slot 1). Requires EXTRA_LIN_ADVANCE_K.
  *  S<0/1>      Activate slot 0 or 1. Requires EXTRA_LIN_ADVANCE_K.
+ *  B<factor>   Set the K factor for blended mixes. Requires MIXING_EXTRUDER.
  */
 void GcodeSuite::M900() {
 
@@ -110,6 +111,18 @@ void GcodeSuite::M900() {
     kref = newK;
   }
 
+  #if ENABLED(MIXING_EXTRUDER)
+    if (parser.seenval('B')) {
+      const float B = parser.value_float();
+      if (!WITHIN(B, 0, 10))
+        echo_value_oor('B');
+      else if (B != planner.mixing_advance_K) {
+        planner.synchronize();
+        planner.mixing_advance_K = B;
+      }
+    }
+  #endif
+
   if (!parser.seen_any()) {
 
     #if ENABLED(EXTRA_LIN_ADVANCE_K)
@@ -140,6 +153,11 @@ void GcodeSuite::M900() {
       #endif
 
     #endif
+
+    #if ENABLED(MIXING_EXTRUDER)
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR("Advance B=", planner.mixing_advance_K);
+    #endif
   }
 
 }
@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(HOTEND_CLEAN_TOWER)
+
+#include "../../gcode.h"
+#include "../../../feature/mixing.h"
+
+/**
+ * M168: Set the tool change purge
+ *
+ *   P[int]   - Pattern. 0 = Off, 1 = Park and wipe, 2 = Tower
+ *   X[int]   - Park point or tower corner X
+ *   Y[int]   - Park point or tower corner Y
+ *   L[int]   - Wipe length or tower width
+ *   V[float] - Mixing chamber and nozzle volume (mm³)
+ *   S[float] - Volume calibration factor
+ *   T[int]   - Old mix left after the purge (%)
+ *   R[float] - Retract length
+ *   F[int]   - Retract speed (mm/s)
+ *
+ * With no parameters report the settings and the totals.
+ * Example: M168 P1 X5 Y5 V40 T3
+ */
+void GcodeSuite::M168() {
+  cleantower_t &ct = mixer.cleantower;
+
+  if (parser.seenval('P')) ct.pattern = _MIN(parser.value_byte(), uint8_t(CLEAN_TOWER));
+  if (parser.seenval('X')) ct.x = parser.value_ushort();
+  if (parser.seenval('Y')) ct.y = parser.value_ushort();
+  if (parser.seenval('L')) ct.length = parser.value_ushort();
+  if (parser.seenval('V')) ct.volume = _MAX(parser.value_float(), 0.0f);
+  if (parser.seenval('S')) ct.factor = _MAX(parser.value_float(), 0.0f);
+  if (parser.seenval('T')) ct.tolerance = constrain(parser.value_byte(), 1, 100);
+  if (parser.seenval('R')) ct.retraction_length = _MAX(parser.value_float(), 0.0f);
+  if (parser.seenval('F')) ct.retraction_speed = _MAX(parser.value_int(), 1);
+
+  SERIAL_ECHOPAIR("Clean Tower P", int(ct.pattern));
+  SERIAL_ECHOPAIR(" X", ct.x, " Y", ct.y, " L", ct.length);
+  SERIAL_ECHOPAIR(" V", ct.volume, " S", ct.factor, " T", int(ct.tolerance));
+  SERIAL_ECHOPAIR(" R", ct.retraction_length, " F", ct.retraction_speed);
+  SERIAL_ECHOPAIR(" ; Purged ", mixer.purged_mm, "mm ; Saved ", mixer.saved_mm);
+  SERIAL_ECHOLNPGM("mm");
+}
+
+#endif // HOTEND_CLEAN_TOWER
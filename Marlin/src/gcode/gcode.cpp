@@ -65,6 +65,10 @@ GcodeSuite gcode;
   #include "../feature/repeat_printing.h"
 #endif
 
+#if ENABLED(PREHEAT_SCHEDULER)
+  #include "../feature/preheat_scheduler.h"
+#endif
+
 
 #include "../MarlinCore.h" // for idle()
 
@@ -170,6 +174,11 @@ void GcodeSuite::get_destination_from_command() {
   else
     destination.e = current_position.e;
 
+  #if ENABLED(PREHEAT_SCHEDULER)
+    // Hold the first extrusion until the deferred heaters are at temperature
+    if (seen.e && !skip_move && destination.e > current_position.e) preheat.check_extrusion();
+  #endif
+
   #if ENABLED(POWER_LOSS_RECOVERY) && !PIN_EXISTS(POWER_LOSS)
     // Only update power loss recovery on moves with E
     if (IS_SD_PRINTING() && seen.e && (seen.x || seen.y))
@@ -523,6 +532,8 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 155: M155(); break;                                  // M155: Set temperature auto-report interval
       #endif
 
+      TERN_(BINARY_TELEMETRY, case 156: M156(); break);           // M156: Binary telemetry stream
+
       #if ENABLED(PARK_HEAD_ON_PAUSE)
         case 125: M125(); break;                                  // M125: Store current position and move to filament change position
       #endif
@@ -553,6 +564,11 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       case 92: M92(); break;                                      // M92: Set the steps-per-unit for one or more axes
       case 114: M114(); break;                                    // M114: Report current position
       case 115: M115(); break;                                    // M115: Report capabilities
+
+      #if ENABLED(PREHEAT_SCHEDULER)
+        case 116: M116(); break;                                  // M116: Wait for heaters / Defer heater waits
+      #endif
+
       case 117: M117(); break;                                    // M117: Set LCD message text, if possible
       case 118: M118(); break;                                    // M118: Display a message in the host console
       case 119: M119(); break;                                    // M119: Report endstop states
@@ -583,6 +599,9 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
 		#if ENABLED(RANDOM_MIX)
           case 167: M167(); break;                                // M167: Set random Mix
 		#endif
+        #if ENABLED(HOTEND_CLEAN_TOWER)
+          case 168: M168(); break;                                // M168: Set tool change purge
+        #endif
       #endif
 
 	  #if ENABLED(OPTION_REPEAT_PRINTING)
@@ -959,7 +978,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
-  char * const current_command = queue.command_buffer[queue.index_r];
+  char * const current_command = queue.command(queue.index_r);
 
   PORT_REDIRECT(queue.port[queue.index_r]);
 
@@ -967,17 +986,26 @@ void GcodeSuite::process_next_command() {
     recovery.queue_index_r = queue.index_r;
   #endif
 
+  // A record was parsed when it was queued
+  #if ENABLED(TOKENIZED_COMMANDS)
+    const bool is_record = *current_command == GCODE_RECORD_MARK;
+    if (is_record) parser.load(current_command);
+  #endif
+
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(current_command);
+    SERIAL_ECHOLN(TERN0(TOKENIZED_COMMANDS, is_record) ? parser.command_ptr : current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.index_r);
-      M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
+      M100_dump_routine(PSTR("   Command Queue:"), (const char*)queue.command_buffer, (const char*)queue.command_buffer + sizeof(queue.command_buffer) - 1);
     #endif
   }
 
+  // An empty command only stands in for the "ok" of a line handled on arrival
+  if (!*current_command) return queue.ok_to_send();
+
   // Parse the next command in the queue
-  parser.parse(current_command);
+  if (!TERN0(TOKENIZED_COMMANDS, is_record)) parser.parse(current_command);
   process_parsed_command();
 }
 
@@ -988,6 +1016,7 @@ void GcodeSuite::process_next_command() {
 
 void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(TOKENIZED_COMMANDS, const bool was_record = parser.from_record);
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
     const size_t len = delim ? delim - pgcode : strlen_P(pgcode); // Get the command length
@@ -999,11 +1028,15 @@ void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
+  #if ENABLED(TOKENIZED_COMMANDS)
+    if (was_record) return parser.reload();           // Restore the record state
+  #endif
   parser.parse(saved_cmd);                            // Restore the parser state
 }
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(TOKENIZED_COMMANDS, const bool was_record = parser.from_record);
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
     if (delim) *delim = '\0';                         // Replace with nul
@@ -1013,6 +1046,9 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     if (!delim) break;                                // Last command?
     gcode = delim + 1;                                // Get the next command
   }
+  #if ENABLED(TOKENIZED_COMMANDS)
+    if (was_record) return parser.reload();           // Restore the record state
+  #endif
   parser.parse(saved_cmd);                            // Restore the parser state
 }
 
@@ -140,6 +140,7 @@
  * M113 - Get or set the timeout interval for Host Keepalive "busy" messages. (Requires HOST_KEEPALIVE_FEATURE)
  * M114 - Report current position.
  * M115 - Report capabilities. (Extended capabilities requires EXTENDED_CAPABILITIES_REPORT)
+ * M116 - Wait for heaters, or defer M190/M109 waits until the first extrusion. (Requires PREHEAT_SCHEDULER)
  * M117 - Display a message on the controller screen. (Requires an LCD)
  * M118 - Display a message in the host console.
  * M119 - Report endstops status.
@@ -157,11 +158,13 @@
  * M149 - Set temperature units. (Requires TEMPERATURE_UNITS_SUPPORT)
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M156 - Binary telemetry stream at S<hz> with record mask R<bits> on port P. (Requires BINARY_TELEMETRY)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
  * M166 - Set the Gradient Mix for the mixing extruder. (Requires GRADIENT_MIX)
  * M167 - Set the Random Mix for the mixing extruder. (Requires RANDOM_MIX)
+ * M168 - Set the tool change purge for the mixing extruder. (Requires HOTEND_CLEAN_TOWER)
  * M190 - S<temp> Wait for bed current temp to reach target temp. ** Wait only when heating! **
  *        R<temp> Wait for bed current temp to reach target temp. ** Wait for heating or cooling. **
  * M200 - Set filament diameter, D<diameter>, setting E axis units to cubic. (Use S0 to revert to linear units.)
@@ -595,6 +598,9 @@ private:
 
   static void M114();
   static void M115();
+
+  TERN_(PREHEAT_SCHEDULER, static void M116());
+
   static void M117();
   static void M118();
   static void M119();
@@ -636,12 +642,15 @@ private:
     static void M155();
   #endif
 
+  TERN_(BINARY_TELEMETRY, static void M156());
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
     TERN_(DIRECT_MIXING_IN_G1, static void M165());
     TERN_(GRADIENT_MIX, static void M166());
 	TERN_(RANDOM_MIX, static void M167());
+    TERN_(HOTEND_CLEAN_TOWER, static void M168());
   #endif
 
   #if ENABLED(OPTION_REPEAT_PRINTING)
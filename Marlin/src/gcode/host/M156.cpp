@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "../gcode.h"
+#include "../../feature/telemetry.h"
+
+/**
+ * M156: Binary telemetry stream
+ *
+ *   S<hz>    Rate in Hz, up to TELEMETRY_MAX_RATE. S0 stops the stream.
+ *   R<mask>  Records to send (default all):
+ *              1 = Temperatures and heater power
+ *              2 = Planner queue depth, stepper positions, feedrate
+ *              4 = SD print position and elapsed time
+ *              8 = Mixing virtual tool and mix percentages
+ *             16 = Fan speeds
+ *   P<port>  Serial port to stream to (default: the port that sent M156)
+ *
+ * With no S or R the current subscription for the port is reported.
+ */
+void GcodeSuite::M156() {
+  #if HAS_MULTI_SERIAL
+    const int8_t cmd_port = serial_port_index;
+    uint8_t port = WITHIN(cmd_port, 0, NUM_SERIAL - 1) ? cmd_port : 0;
+  #else
+    uint8_t port = 0;
+  #endif
+  if (parser.seenval('P')) {
+    port = parser.value_byte();
+    if (port >= NUM_SERIAL) {
+      SERIAL_ECHOLNPGM("?Invalid (P)ort.");
+      return;
+    }
+  }
+
+  if (!parser.seen("SR")) return telemetry.report(port);
+
+  const uint8_t hz = parser.seenval('S') ? parser.value_byte() : TELEMETRY_MAX_RATE,
+                mask = parser.seenval('R') ? parser.value_byte() : Telemetry::all_records;
+
+  telemetry.subscribe(port, hz, mask);
+}
+
+#endif // BINARY_TELEMETRY
@@ -54,7 +54,7 @@ void GcodeSuite::M360() {
   //
   config_line(PSTR("Baudrate"), BAUDRATE);
   config_line(PSTR("InputBuffer"), MAX_CMD_SIZE);
-  config_line(PSTR("PrintlineCache"), BUFSIZE);
+  config_line(PSTR("PrintlineCache"), CMD_QUEUE_SLOTS);
   config_line(PSTR("MixingExtruder"), ENABLED(MIXING_EXTRUDER));
   config_line(PSTR("SDCard"), ENABLED(SDSUPPORT));
   config_line(PSTR("Fan"), ENABLED(HAS_FAN));
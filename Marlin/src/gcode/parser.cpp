@@ -66,6 +66,11 @@ int GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if ENABLED(TOKENIZED_COMMANDS)
+    gcode_record_t GCodeParser::record;
+    float GCodeParser::record_value;
+    bool GCodeParser::from_record;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -86,6 +91,7 @@ void GCodeParser::reset() {
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
+    TERN_(TOKENIZED_COMMANDS, from_record = false); // Not a record
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
 }
@@ -341,6 +347,140 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(TOKENIZED_COMMANDS)
+
+  /**
+   * Convert a hot command to a record in place, reading it exactly as
+   * parse() and value_float() would. Return false to leave it as text.
+   */
+  bool GCodeParser::tokenize(char * const cmd) {
+
+    auto uppercase = [](char c) {
+      if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
+        c += 'A' - 'a';
+      return c;
+    };
+
+    char *p = cmd;
+    while (*p == ' ') ++p;
+
+    // The "ok" of ADVANCED_OK echoes the line number from the text
+    if (uppercase(*p) == 'N' && NUMERIC_SIGNED(p[1])) {
+      if (ENABLED(ADVANCED_OK)) return false;
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    const char letter = uppercase(*p++);
+    if (letter != 'G' && letter != 'M') return false;
+    while (*p == ' ') ++p;
+    if (!NUMERIC(*p)) return false;
+
+    uint16_t code = 0;
+    do {
+      code = code * 10 + *p++ - '0';
+      if (code > 255) return false;
+    } while (NUMERIC(*p));
+    if (*p == '.') return false;          // Sub-codes stay as text
+
+    switch (code) {
+      case 0 ... 1: TERN_(ARC_SUPPORT, case 2 ... 3:) case 92:
+        if (letter != 'G') return false; break;
+      case 104: case 106: case 107:
+        if (letter != 'M') return false; break;
+      default: return false;
+    }
+
+    char * const starpos = strchr(p, '*');
+    if (starpos) *starpos = '\0';        // As parse() would do
+
+    uint32_t bits = 0;
+    float val[26];
+    while (*p == ' ') ++p;
+    while (const char c = uppercase(*p++)) {
+      if (!WITHIN(c, 'A', 'Z')) return false;   // Would be a string_arg
+      while (*p == ' ') ++p;
+      if (!valid_float(p)) return false;        // A flag with no value
+
+      // Copy the number, ending where value_float() would
+      char num[16];
+      uint8_t n = 0;
+      for (; DECIMAL_SIGNED(p[n]); ++n) {
+        if (n >= COUNT(num) - 1) return false;
+        num[n] = p[n];
+      }
+      if (p[n] == 'x' || p[n] == 'X') return false; // A hex float
+      num[n] = '\0';
+
+      const uint8_t ind = LETTER_BIT(c);
+      val[ind] = strtof(num, nullptr);
+      SBI32(bits, ind);
+
+      if (!WITHIN(*p, 'A', 'Z')) {
+        while (*p && DECIMAL_SIGNED(*p)) ++p;
+        while (*p == ' ') ++p;
+      }
+    }
+
+    const uint8_t count = __builtin_popcount(bits);
+    if (GCODE_RECORD_HEADER + count * sizeof(float) > MAX_CMD_SIZE) return false;
+
+    // Write the record over the text
+    char *out = cmd;
+    *out++ = GCODE_RECORD_MARK;
+    *out++ = letter;
+    *out++ = char(code);
+    memcpy(out, &bits, sizeof(bits)); out += sizeof(bits);
+    LOOP_L_N(i, COUNT(val)) if (TEST32(bits, i)) {
+      memcpy(out, &val[i], sizeof(float));
+      out += sizeof(float);
+    }
+    return true;
+  }
+
+  uint8_t GCodeParser::record_size(const char * const cmd) {
+    uint32_t bits;
+    memcpy(&bits, cmd + 3, sizeof(bits));
+    return GCODE_RECORD_HEADER + __builtin_popcount(bits) * sizeof(float);
+  }
+
+  // The record may be unaligned in the queue, so copy it out
+  void GCodeParser::load(const char * const cmd) {
+    record.letter = cmd[1];
+    record.codenum = uint8_t(cmd[2]);
+    memcpy(&record.bits, cmd + 3, sizeof(record.bits));
+    memcpy(record.value, cmd + GCODE_RECORD_HEADER, __builtin_popcount(record.bits) * sizeof(float));
+    apply_record();
+  }
+
+  void GCodeParser::apply_record() {
+    reset();
+    command_letter = record.letter;
+    codenum = record.codenum;
+    codebits = record.bits;
+    from_record = true;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G' && codenum <= 3) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = 0);
+      }
+    #endif
+
+    // Name the command for echo and warnings
+    static char name[5];
+    char *n = name;
+    *n++ = command_letter;
+    if (codenum >= 100) *n++ = '0' + codenum / 100;
+    if (codenum >= 10) *n++ = '0' + codenum / 10 % 10;
+    *n++ = '0' + codenum % 10;
+    *n = '\0';
+    command_ptr = name;
+  }
+
+#endif // TOKENIZED_COMMANDS
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -42,6 +42,22 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if ENABLED(TOKENIZED_COMMANDS)
+  /**
+   * A queued command stored as a binary record. In the queue it is packed as
+   * GCODE_RECORD_MARK, letter, code, bits, then one float per set bit in
+   * letter order. A text command never starts with the mark.
+   */
+  #define GCODE_RECORD_MARK   '\x01'
+  #define GCODE_RECORD_HEADER 7
+  typedef struct {
+    char letter;                    // G or M
+    uint8_t codenum;                // All the tokenized codes fit a byte
+    uint32_t bits;                  // Letters present, all with a value
+    float value[26];                // Values of the set bits, in letter order
+  } gcode_record_t;
+#endif
+
 /**
  * GCode parser
  *
@@ -62,6 +78,11 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if ENABLED(TOKENIZED_COMMANDS)
+      static gcode_record_t record; // The record being executed
+      static float record_value;    // Set by seen, pointed to by value_ptr
+      static void apply_record();
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -101,6 +122,10 @@ public:
     static void debug();
   #endif
 
+  #if ENABLED(TOKENIZED_COMMANDS)
+    static bool from_record;              // Parameters come from 'record'
+  #endif
+
   // Reset is done before parsing
   static void reset();
 
@@ -147,6 +172,13 @@ public:
       if (ind >= COUNT(param)) return false; // Only A-Z
       const bool b = TEST32(codebits, ind);
       if (b) {
+        #if ENABLED(TOKENIZED_COMMANDS)
+          if (from_record) {
+            record_value = record.value[__builtin_popcount(codebits & (_BV32(ind) - 1))];
+            value_ptr = (char*)&record_value;
+            return true;
+          }
+        #endif
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
           value_ptr = valid_number(ptr) ? ptr : nullptr;
@@ -239,6 +271,17 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(TOKENIZED_COMMANDS)
+    // Convert a queued command to a record in place, if it's a hot one
+    static bool tokenize(char * const cmd);
+    // Bytes taken in the queue by a record
+    static uint8_t record_size(const char * const cmd);
+    // Set up the parser state from a queued record
+    static void load(const char * const cmd);
+    // Restore the state of the loaded record after running subcommands
+    FORCE_INLINE static void reload() { apply_record(); }
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -255,6 +298,9 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
+    #if ENABLED(TOKENIZED_COMMANDS)
+      if (from_record) return value_ptr ? record_value : 0;
+    #endif
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
@@ -274,8 +320,19 @@ public:
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(TOKENIZED_COMMANDS)
+    static inline int32_t value_long() {
+      if (from_record) return value_ptr ? int32_t(record_value) : 0L;
+      return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+    }
+    static inline uint32_t value_ulong() {
+      if (from_record) return value_ptr ? uint32_t(int32_t(record_value)) : 0UL;
+      return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+    }
+  #else
+    static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -51,6 +51,10 @@ GCodeQueue queue;
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING_SD)
+  #include "../feature/sd_step_job.h"
+#endif
+
 /**
  * GCode line number handling. Hosts may opt to include line numbers when
  * sending commands to Marlin, and lines will be checked for sequentiality.
@@ -71,13 +75,19 @@ uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
         GCodeQueue::index_r = 0, // Ring buffer read position
         GCodeQueue::index_w = 0; // Ring buffer write position
 
-char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  char GCodeQueue::command_buffer[(BUFSIZE) * (MAX_CMD_SIZE)];
+  uint16_t GCodeQueue::command_start[CMD_QUEUE_SLOTS],
+           GCodeQueue::text_w = 0;  // Byte ring write position
+#else
+  char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#endif
 
 /*
  * The port that the command was received on
  */
 #if HAS_MULTI_SERIAL
-  int16_t GCodeQueue::port[BUFSIZE];
+  int16_t GCodeQueue::port[CMD_QUEUE_SLOTS];
 #endif
 
 /**
@@ -87,7 +97,7 @@ char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
 // Number of characters read in the current line of serial input
 static int serial_count[NUM_SERIAL] = { 0 };
 
-bool send_ok[BUFSIZE];
+bool send_ok[CMD_QUEUE_SLOTS];
 
 /**
  * Next Injected PROGMEM Command pointer. (nullptr == empty)
@@ -117,8 +127,62 @@ bool GCodeQueue::has_commands_queued() {
  */
 void GCodeQueue::clear() {
   index_r = index_w = length = 0;
+  TERN_(PACKED_COMMAND_QUEUE, text_w = 0);
 }
 
+/**
+ * Get the place to write the next command, with room for MAX_CMD_SIZE.
+ * Return nullptr if the queue is full.
+ *
+ * With PACKED_COMMAND_QUEUE the queued strings occupy the bytes from the
+ * oldest string (at index_r) up to text_w, possibly wrapping once. A new
+ * string goes at text_w, or at the start of the ring if it won't fit
+ * before the end.
+ */
+char* GCodeQueue::next_command_space() {
+  if (length >= CMD_QUEUE_SLOTS) return nullptr;
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    if (!length)
+      text_w = 0;
+    else {
+      const uint16_t r = command_start[index_r];
+      if (text_w > r) {
+        if (text_w + (MAX_CMD_SIZE) > sizeof(command_buffer))
+          return r >= (MAX_CMD_SIZE) ? command_buffer : nullptr;
+      }
+      else if (text_w + (MAX_CMD_SIZE) > r)
+        return nullptr;
+    }
+    return &command_buffer[text_w];
+  #else
+    return command_buffer[index_w];
+  #endif
+}
+
+#if ENABLED(PACKED_COMMAND_QUEUE)
+
+  /**
+   * Bytes not taken by queued commands. Reported by ADVANCED_OK.
+   */
+  uint16_t GCodeQueue::free_bytes() {
+    if (!length) return sizeof(command_buffer);
+    const uint16_t r = command_start[index_r];
+    return text_w > r ? sizeof(command_buffer) - text_w + r : r - text_w;
+  }
+
+#endif
+
+#if BOTH(TOKENIZED_COMMANDS, SDSUPPORT)
+
+  bool GCodeQueue::text_only; // = false
+
+  FORCE_INLINE bool is_M28(const char * const cmd) {  // matches "M28" & "M28 ", but not "M280", etc
+    const char * const m28 = strstr_P(cmd, PSTR("M28"));
+    return m28 && !NUMERIC(m28[3]);
+  }
+
+#endif
+
 /**
  * Once a new command is in the ring buffer, call this to commit it
  */
@@ -127,10 +191,30 @@ void GCodeQueue::_commit_command(bool say_ok
     , int16_t p/*=-1*/
   #endif
 ) {
+  #if EITHER(PACKED_COMMAND_QUEUE, TOKENIZED_COMMANDS)
+    // The string is already in place at next_command_space()
+    char * const cmd = next_command_space();
+  #endif
+
+  #if ENABLED(TOKENIZED_COMMANDS)
+    if (*cmd == GCODE_RECORD_MARK) *cmd = ' ';  // Never mistake text for a record
+    #if ENABLED(SDSUPPORT)
+      // Lines written to a file by M28 must stay as text
+      if (card.flag.saving) text_only = true;
+      else if (text_only && !length) text_only = false;
+      if (is_M28(cmd)) text_only = true;
+    #endif
+    const bool is_record = !TERN0(SDSUPPORT, text_only) && parser.tokenize(cmd);
+  #endif
+
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    command_start[index_w] = cmd - command_buffer;
+    text_w = command_start[index_w] + (TERN0(TOKENIZED_COMMANDS, is_record) ? parser.record_size(cmd) : strlen(cmd) + 1);
+  #endif
   send_ok[index_w] = say_ok;
   TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
-  if (++index_w >= BUFSIZE) index_w = 0;
+  if (++index_w >= CMD_QUEUE_SLOTS) index_w = 0;
   length++;
 }
 
@@ -144,8 +228,9 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
     , int16_t pn/*=-1*/
   #endif
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
+  char * const buff = next_command_space();
+  if (*cmd == ';' || !buff) return false;
+  strcpy(buff, cmd);
   _commit_command(say_ok
     #if HAS_MULTI_SERIAL
       , pn
@@ -286,7 +371,7 @@ void GCodeQueue::ok_to_send() {
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
+    char* p = command(index_r);
     if (*p == 'N') {
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
@@ -294,7 +379,8 @@ void GCodeQueue::ok_to_send() {
         SERIAL_ECHO(*p++);
     }
     SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()),
-                      SP_B_STR, int(BUFSIZE - length));
+                      SP_B_STR, int(CMD_QUEUE_SLOTS - length));
+    TERN_(PACKED_COMMAND_QUEUE, SERIAL_ECHOPAIR(" F", free_bytes()));
   #endif
   SERIAL_EOL();
 }
@@ -458,7 +544,7 @@ void GCodeQueue::get_serial_commands() {
   /**
    * Loop while serial characters are incoming and the queue is not full
    */
-  while (length < BUFSIZE && serial_data_available()) {
+  while (has_space() && serial_data_available()) {
     LOOP_L_N(i, NUM_SERIAL) {
 
       const int c = read_serial(i);
@@ -548,11 +634,15 @@ void GCodeQueue::get_serial_commands() {
 			if(zpos){
 				const float offs = constrain(strtof(zpos + 1, nullptr),-2,2);
 				babystep.add_mm(Z_AXIS, offs);
-				_commit_command(true
-	    		#if HAS_MULTI_SERIAL
-	      		, i
-	    		#endif
-	  			);
+				char * const ok_cmd = next_command_space();	// Queue an empty command just for the "ok"
+				if (ok_cmd) {
+					*ok_cmd = '\0';
+					_commit_command(true
+		    		#if HAS_MULTI_SERIAL
+		      		, i
+		    		#endif
+		  			);
+				}
 			  	continue;
 			}
 		  }
@@ -589,9 +679,15 @@ void GCodeQueue::get_serial_commands() {
 
     if (!IS_SD_PRINTING()) return;
 
+    #if ENABLED(DIRECT_STEPPING_SD)
+      if (sd_step_job.active()) return sd_step_job.service();
+    #endif
+
     int sd_count = 0;
     bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
+    char *buff;
+    while ((buff = next_command_space()) && !card_eof) {
+      char (&command)[MAX_CMD_SIZE] = *reinterpret_cast<char (*)[MAX_CMD_SIZE]>(buff);
       const int16_t n = card.get();
       card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -602,7 +698,7 @@ void GCodeQueue::get_serial_commands() {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+        if (!process_line_done(sd_input_state, command, sd_count)) {
           _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
@@ -612,7 +708,7 @@ void GCodeQueue::get_serial_commands() {
         if (card_eof) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
+        process_stream_char(sd_char, sd_input_state, command, sd_count);
 
     }
   }
@@ -646,7 +742,7 @@ void GCodeQueue::advance() {
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
+      char* command = GCodeQueue::command(index_r);
       if (is_M29(command)) {
         // M29 closes the file
         card.closefile();
@@ -683,6 +779,6 @@ void GCodeQueue::advance() {
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
   --length;
-  if (++index_r >= BUFSIZE) index_r = 0;
+  if (++index_r >= CMD_QUEUE_SLOTS) index_r = 0;
 
 }
@@ -42,6 +42,10 @@ public:
    * GCode Command Queue
    * A simple ring buffer of BUFSIZE command strings.
    *
+   * With PACKED_COMMAND_QUEUE the strings are stored end-to-end in a byte
+   * ring of the same size. Each of the CMD_QUEUE_SLOTS slots records where
+   * its string starts. A string never wraps around the end of the ring.
+   *
    * Commands are copied into this buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
@@ -50,13 +54,20 @@ public:
   static uint8_t length,  // Count of commands in the queue
                  index_r; // Ring buffer read position
 
-  static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static char command_buffer[(BUFSIZE) * (MAX_CMD_SIZE)];
+    static uint16_t command_start[CMD_QUEUE_SLOTS]; // Offset of each slot's string
+    static inline char* command(const uint8_t index) { return &command_buffer[command_start[index]]; }
+  #else
+    static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+    static inline char* command(const uint8_t index) { return command_buffer[index]; }
+  #endif
 
   /**
    * The port that the command was received on
    */
   #if HAS_MULTI_SERIAL
-    static int16_t port[BUFSIZE];
+    static int16_t port[CMD_QUEUE_SLOTS];
   #endif
 
   static int16_t command_port() {
@@ -117,6 +128,11 @@ public:
    */
   static bool has_commands_queued();
 
+  /**
+   * Check whether a full-length command can be added to the queue
+   */
+  static inline bool has_space() { return next_command_space() != nullptr; }
+
   /**
    * Get the next command in the queue, optionally log it to SD, then dispatch it
    */
@@ -151,6 +167,18 @@ private:
 
   static uint8_t index_w;  // Ring buffer write position
 
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static uint16_t text_w;  // Byte ring write position
+    static uint16_t free_bytes();
+  #endif
+
+  #if BOTH(TOKENIZED_COMMANDS, SDSUPPORT)
+    static bool text_only;   // An M28 may be queued, so lines must stay as text for the file
+  #endif
+
+  // Where the next command can be written with room for MAX_CMD_SIZE, or nullptr if the queue is full
+  static char* next_command_space();
+
   static void get_serial_commands();
 
   #if ENABLED(SDSUPPORT)
@@ -30,11 +30,22 @@
 /**
  * M21: Init SD Card
  */
-void GcodeSuite::M21() { card.mount(); }
+void GcodeSuite::M21() {
+  #ifdef USB_MSC_CACHE_SECTORS
+    MSC_SD_flush(); // Sectors written over USB first
+  #endif
+  card.mount();
+}
 
 /**
  * M22: Release SD Card
  */
-void GcodeSuite::M22() { card.release(); }
+void GcodeSuite::M22() {
+  #ifdef USB_MSC_CACHE_SECTORS
+    MSC_SD_flush(); // Sectors written over USB before the card goes
+    MSC_SD_report();
+  #endif
+  card.release();
+}
 
 #endif // SDSUPPORT
@@ -49,6 +49,10 @@
   #include "../../module/tool_change.h"
 #endif
 
+#if ENABLED(PREHEAT_SCHEDULER)
+  #include "../../feature/preheat_scheduler.h"
+#endif
+
 /**
  * M104: Set Hotend Temperature target and return immediately
  *
@@ -107,6 +111,8 @@ void GcodeSuite::M104() {
        */
       thermalManager.check_timer_autostart(false, true);
     #endif
+
+    TERN_(PREHEAT_SCHEDULER, preheat.defer_hotend(target_extruder, temp, false, true));
   }
 
   TERN_(AUTOTEMP, planner.autotemp_M104_M109());
@@ -132,6 +138,8 @@ void GcodeSuite::M104() {
  *
  * With PRINTJOB_TIMER_AUTOSTART turning on heaters will start the print job timer
  *  (used by printingIsActive, etc.) and turning off heaters will stop the timer.
+ *
+ * With PREHEAT_SCHEDULER the wait may be deferred until the first extrusion (See M116)
  */
 void GcodeSuite::M109() {
 
@@ -193,6 +201,10 @@ void GcodeSuite::M109() {
 
   TERN_(AUTOTEMP, planner.autotemp_M104_M109());
 
+  // At the start of a job the wait may be deferred until the first extrusion
+  if (TERN0(PREHEAT_SCHEDULER, got_temp && preheat.defer_hotend(target_extruder, temp, true, no_wait_for_cooling)))
+    return;
+
   if (got_temp)
     (void)thermalManager.wait_for_hotend(target_extruder, no_wait_for_cooling);
 }
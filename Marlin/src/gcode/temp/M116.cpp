@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PREHEAT_SCHEDULER)
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+#include "../../feature/preheat_scheduler.h"
+
+/**
+ * M116: Wait for heaters, or control deferred heat-up
+ *
+ *  S1 : Defer the waits of following M190 / M109 until the first extrusion,
+ *       holding the hotend at PREHEAT_PROBE_STANDBY_TEMP until G29 is done.
+ *  S0 : Stop deferring. Restore hotend targets without waiting.
+ *
+ * With no parameters wait for deferred heaters, or all heaters with a target.
+ */
+void GcodeSuite::M116() {
+
+  if (DEBUGGING(DRYRUN)) return;
+
+  if (parser.seen('S')) {
+    preheat.enable(parser.value_bool());
+    return;
+  }
+
+  if (preheat.deferring) {
+    preheat.wait_for_heaters();
+    return;
+  }
+
+  #if HAS_HEATED_BED
+    if (thermalManager.degTargetBed()) thermalManager.wait_for_bed();
+  #endif
+
+  #if HAS_TEMP_HOTEND
+    HOTEND_LOOP() if (thermalManager.degTargetHotend(e)) (void)thermalManager.wait_for_hotend(e);
+  #endif
+}
+
+#endif // PREHEAT_SCHEDULER
@@ -43,6 +43,10 @@
   #include "../../feature/leds/leds.h"
 #endif
 
+#if ENABLED(PREHEAT_SCHEDULER)
+  #include "../../feature/preheat_scheduler.h"
+#endif
+
 #include "../../MarlinCore.h" // for wait_for_heatup, idle, startOrResumeJob
 
 /**
@@ -100,6 +104,8 @@ void GcodeSuite::M140() {
  *
  * With PRINTJOB_TIMER_AUTOSTART turning on heaters will start the print job timer
  *  (used by printingIsActive, etc.) and turning off heaters will stop the timer.
+ *
+ * With PREHEAT_SCHEDULER the wait may be deferred until the first extrusion (See M116)
  */
 void GcodeSuite::M190() {
   if (DEBUGGING(DRYRUN)) return;
@@ -132,6 +138,9 @@ void GcodeSuite::M190() {
 
   ui.set_status_P(thermalManager.isHeatingBed() ? GET_TEXT(MSG_BED_HEATING) : GET_TEXT(MSG_BED_COOLING));
 
+  // At the start of a job the wait may be deferred until the first extrusion
+  if (TERN0(PREHEAT_SCHEDULER, preheat.defer_bed(no_wait_for_cooling))) return;
+
   thermalManager.wait_for_bed(no_wait_for_cooling);
 }
 
@@ -468,6 +468,23 @@
   #define NEED_LSF 1
 #endif
 
+// Blended mixes default to the regular K
+#if BOTH(LIN_ADVANCE, MIXING_EXTRUDER) && !defined(MIXING_ADVANCE_K)
+  #define MIXING_ADVANCE_K LIN_ADVANCE_K
+#endif
+
+// Flag whether gcode_scanner.cpp is used
+#if ENABLED(SDSUPPORT) && EITHER(ADAPTIVE_MESH_PROBING, JOB_ANALYZER)
+  #define NEED_GCODE_SCANNER 1
+#endif
+
+// Number of commands the G-code queue can hold
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define CMD_QUEUE_SLOTS PACKED_QUEUE_SLOTS
+#else
+  #define CMD_QUEUE_SLOTS BUFSIZE
+#endif
+
 // Flag the indexed serial ports that are in use
 #define ANY_SERIAL_IS(N) (defined(SERIAL_PORT) && SERIAL_PORT == (N)) || (defined(SERIAL_PORT_2) && SERIAL_PORT_2 == (N)) || (defined(LCD_SERIAL_PORT) && LCD_SERIAL_PORT == (N)) || (defined(WIFI_SERIAL_PORT) && WIFI_SERIAL_PORT == (N))
 #if ANY_SERIAL_IS(-1)
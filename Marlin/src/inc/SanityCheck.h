@@ -746,6 +746,56 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * LCD Glyph Cache
+ */
+#if defined(LCD_GLYPH_CACHE) && !WITHIN(LCD_GLYPH_CACHE, 4, 255)
+  #error "LCD_GLYPH_CACHE must be from 4 to 255."
+#endif
+
+/**
+ * ST7920 Framebuffer
+ */
+#if ENABLED(ST7920_FRAMEBUFFER)
+  #if DISABLED(U8GLIB_ST7920)
+    #error "ST7920_FRAMEBUFFER requires a U8GLIB_ST7920-based display."
+  #elif ENABLED(LIGHTWEIGHT_UI)
+    #error "ST7920_FRAMEBUFFER is not compatible with LIGHTWEIGHT_UI."
+  #endif
+#endif
+
+/**
+ * Touch UI command batching
+ */
+#ifdef TOUCH_UI_CMD_BATCH_SIZE
+  #if DISABLED(TOUCH_UI_FTDI_EVE)
+    #error "TOUCH_UI_CMD_BATCH_SIZE requires TOUCH_UI_FTDI_EVE."
+  #elif TOUCH_UI_CMD_BATCH_SIZE % 4 || !WITHIN(TOUCH_UI_CMD_BATCH_SIZE, 4, 4092)
+    #error "TOUCH_UI_CMD_BATCH_SIZE must be a multiple of 4 from 4 to 4092."
+  #endif
+#endif
+
+/**
+ * SD Background Scan
+ */
+#if ENABLED(SD_BACKGROUND_SCAN)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_BACKGROUND_SCAN requires SDSUPPORT."
+  #elif ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
+    #error "SD_BACKGROUND_SCAN is not needed with SDSORT_CACHE_NAMES."
+  #elif !defined(SD_SCAN_SLICE_MS) || SD_SCAN_SLICE_MS < 1
+    #error "SD_SCAN_SLICE_MS must be 1 or more."
+  #endif
+#endif
+
+#if ENABLED(JOB_ANALYZER)
+  #if DISABLED(SDSUPPORT)
+    #error "JOB_ANALYZER requires SDSUPPORT."
+  #elif !defined(JOB_ANALYZER_SLICE_MS) || JOB_ANALYZER_SLICE_MS < 1
+    #error "JOB_ANALYZER_SLICE_MS must be 1 or more."
+  #endif
+#endif
+
 /**
  * SD File Sorting
  */
@@ -1038,6 +1088,9 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     WITHIN(LIN_ADVANCE_K, 0, 10),
     "LIN_ADVANCE_K must be a value from 0 to 10 (Changed in LIN_ADVANCE v1.5, Marlin 1.1.9)."
   );
+  #if ENABLED(MIXING_EXTRUDER)
+    static_assert(WITHIN(MIXING_ADVANCE_K, 0, 10), "MIXING_ADVANCE_K must be a value from 0 to 10.");
+  #endif
   #if ENABLED(S_CURVE_ACCELERATION) && DISABLED(EXPERIMENTAL_SCURVE)
     #error "LIN_ADVANCE and S_CURVE_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE to continue."
   #endif
@@ -1167,6 +1220,51 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * Preheat Scheduler requirements
+ */
+#if ENABLED(PREHEAT_SCHEDULER)
+  #if !HAS_HOTEND
+    #error "PREHEAT_SCHEDULER requires at least one hotend."
+  #elif !defined(PREHEAT_PROBE_STANDBY_TEMP)
+    #error "PREHEAT_SCHEDULER requires PREHEAT_PROBE_STANDBY_TEMP."
+  #elif ENABLED(PREHEAT_SCHEDULER_AUTO) && DISABLED(SDSUPPORT)
+    #error "PREHEAT_SCHEDULER_AUTO requires SDSUPPORT."
+  #elif defined(PREHEAT_PROBE_BED_WINDOW) && !HAS_HEATED_BED
+    #error "PREHEAT_PROBE_BED_WINDOW requires a heated bed."
+  #endif
+#endif
+
+/**
+ * Tokenized Commands requirements
+ */
+#if ENABLED(TOKENIZED_COMMANDS) && DISABLED(FASTER_GCODE_PARSER)
+  #error "TOKENIZED_COMMANDS requires FASTER_GCODE_PARSER."
+#endif
+
+/**
+ * Packed Command Queue requirements
+ */
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #ifndef PACKED_QUEUE_SLOTS
+    #error "PACKED_COMMAND_QUEUE requires PACKED_QUEUE_SLOTS."
+  #endif
+  static_assert(WITHIN(PACKED_QUEUE_SLOTS, BUFSIZE, 255), "PACKED_QUEUE_SLOTS must be from BUFSIZE to 255.");
+  static_assert(BUFSIZE >= 2, "PACKED_COMMAND_QUEUE requires BUFSIZE of 2 or more.");
+#endif
+
+/**
+ * Binary Telemetry requirements
+ */
+#if ENABLED(BINARY_TELEMETRY)
+  #if !defined(TELEMETRY_MAX_RATE) || !defined(TELEMETRY_BUFFER_SIZE) || !defined(TELEMETRY_TX_CHUNK)
+    #error "BINARY_TELEMETRY requires TELEMETRY_MAX_RATE, TELEMETRY_BUFFER_SIZE, and TELEMETRY_TX_CHUNK."
+  #endif
+  static_assert(WITHIN(TELEMETRY_MAX_RATE, 1, 50), "TELEMETRY_MAX_RATE must be from 1 to 50.");
+  static_assert(WITHIN(TELEMETRY_BUFFER_SIZE, 64, 1024), "TELEMETRY_BUFFER_SIZE must be from 64 to 1024.");
+  static_assert(TELEMETRY_TX_CHUNK >= 64, "TELEMETRY_TX_CHUNK must be at least 64 so any record fits.");
+#endif
+
 /**
  * Kinematics
  */
@@ -1451,6 +1549,31 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   static_assert(DEFAULT_ZJERK > 0.1, "Low DEFAULT_ZJERK values are incompatible with mesh-based leveling.");
 #endif
 
+#if ENABLED(FAST_MESH_PROBING)
+  #if !HAS_BED_PROBE || NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
+    #error "FAST_MESH_PROBING requires a probe and AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR."
+  #elif IS_KINEMATIC
+    #error "FAST_MESH_PROBING is not compatible with DELTA or SCARA."
+  #elif defined(MULTIPLE_PROBING) && MULTIPLE_PROBING > 2
+    #error "FAST_MESH_PROBING is not compatible with MULTIPLE_PROBING > 2."
+  #elif ENABLED(FAST_MESH_REUSE_TOUCH) && !(FAST_MESH_REUSE_CHECKS > 0)
+    #error "FAST_MESH_REUSE_CHECKS must be greater than 0."
+  #endif
+  static_assert(FAST_MESH_APPROACH > 0 && FAST_MESH_LIFT >= FAST_MESH_APPROACH, "FAST_MESH_PROBING requires FAST_MESH_LIFT >= FAST_MESH_APPROACH > 0.");
+  static_assert(FAST_MESH_MIN_CLEARANCE >= 0 && FAST_MESH_MIN_CLEARANCE < FAST_MESH_APPROACH, "FAST_MESH_PROBING requires 0 <= FAST_MESH_MIN_CLEARANCE < FAST_MESH_APPROACH.");
+#endif
+
+#if ENABLED(ADAPTIVE_MESH_PROBING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ADAPTIVE_MESH_PROBING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "ADAPTIVE_MESH_PROBING is not compatible with PROBE_MANUALLY."
+  #elif !defined(ADAPTIVE_MESH_MARGIN) || !defined(ADAPTIVE_MESH_SPACING) || !defined(ADAPTIVE_MESH_SCAN_TIME)
+    #error "ADAPTIVE_MESH_PROBING requires ADAPTIVE_MESH_MARGIN, ADAPTIVE_MESH_SPACING, and ADAPTIVE_MESH_SCAN_TIME."
+  #endif
+  static_assert(ADAPTIVE_MESH_SPACING > 0, "ADAPTIVE_MESH_SPACING must be greater than 0.");
+#endif
+
 #if ENABLED(G26_MESH_VALIDATION)
   #if !EXTRUDERS
     #error "G26_MESH_VALIDATION requires at least one extruder."
@@ -2098,6 +2221,10 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
   #endif
 #endif
 
+#if ENABLED(Z_MULTI_HOMING_ISR_STOP) && (DISABLED(Z_MULTI_ENDSTOPS) || NUM_Z_STEPPER_DRIVERS != 2)
+  #error "Z_MULTI_HOMING_ISR_STOP requires Z_MULTI_ENDSTOPS with 2 Z stepper drivers."
+#endif
+
 #if defined(ENDSTOP_NOISE_THRESHOLD) && !WITHIN(ENDSTOP_NOISE_THRESHOLD, 2, 7)
   #error "ENDSTOP_NOISE_THRESHOLD must be an integer from 2 to 7."
 #endif
@@ -2956,6 +3083,34 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "GRADIENT_MIX requires 2 or more MIXING_VIRTUAL_TOOLS."
 #endif
 
+#if ENABLED(SD_UPLOAD_STREAM)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_UPLOAD_STREAM requires SDSUPPORT."
+  #elif EITHER(USB_FLASH_DRIVE_SUPPORT, SDCARD_READONLY)
+    #error "SD_UPLOAD_STREAM requires a writable SD card."
+  #elif !WITHIN(SD_UPLOAD_BLOCKS, 2, 64)
+    #error "SD_UPLOAD_BLOCKS must be from 2 to 64."
+  #endif
+#endif
+
+#if ENABLED(SDIO_READ_AHEAD) && !(ENABLED(SDIO_SUPPORT) && defined(__STM32F1__))
+  #error "SDIO_READ_AHEAD requires SDIO_SUPPORT on STM32F1."
+#endif
+
+#ifdef USB_MSC_CACHE_SECTORS
+  #if !defined(__STM32F1__) || !defined(USB_MASS_STORAGE)
+    #error "USB_MSC_CACHE_SECTORS requires an STM32F1 build with USB_MASS_STORAGE."
+  #elif !SD_CONNECTION_IS(ONBOARD) || ENABLED(NO_SD_HOST_DRIVE)
+    #error "USB_MSC_CACHE_SECTORS requires an ONBOARD SDCARD_CONNECTION shared over USB."
+  #elif !WITHIN(USB_MSC_CACHE_SECTORS, 2, 64)
+    #error "USB_MSC_CACHE_SECTORS must be from 2 to 64."
+  #endif
+#endif
+
+#if ENABLED(HOTEND_CLEAN_TOWER) && DISABLED(MIXING_EXTRUDER)
+  #error "HOTEND_CLEAN_TOWER requires MIXING_EXTRUDER."
+#endif
+
 /**
  * Photo G-code requirements
  */
@@ -3165,6 +3320,9 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
 #if BOTH(DIRECT_STEPPING, LIN_ADVANCE)
   #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
 #endif
+#if ENABLED(DIRECT_STEPPING_SD) && DISABLED(SDSUPPORT)
+  #error "DIRECT_STEPPING_SD requires SDSUPPORT."
+#endif
 
 /**
  * Touch Buttons
@@ -205,4 +205,89 @@ u8g_dev_t u8g_dev_st7920_128x64_HAL_4x_hw_spi = { u8g_dev_st7920_128x64_HAL_4x_f
   u8g_dev_t u8g_dev_st7920_128x64_rrd_sw_spi = { u8g_dev_st7920_128x64_HAL_4x_fn, &u8g_dev_st7920_128x64_HAL_4x_pb, U8G_COM_ST7920_HAL_SW_SPI };
 #endif
 
+#if ENABLED(ST7920_FRAMEBUFFER)
+
+  /**
+   * Full-frame ST7920 device
+   *
+   * The whole 128x64 screen is rendered into one 1K page. On PAGE_NEXT
+   * the frame is compared with the copy last sent to GDRAM, one 16-pixel
+   * word at a time, and only runs of changed words are addressed and sent.
+   * An idle status screen then costs a memcmp instead of 1K of slow SPI.
+   */
+  #define FB_ROW_BYTES ((LCD_PIXEL_WIDTH) / 8)
+  #define FB_ROW_WORDS (FB_ROW_BYTES / 2)
+  #define FB_SIZE      (FB_ROW_BYTES * (LCD_PIXEL_HEIGHT))
+
+  uint8_t u8g_dev_st7920_128x64_HAL_fb_buf[FB_SIZE] U8G_NOCOMMON;
+  static uint8_t st7920_fb_sent[FB_SIZE];   // The frame as it is in GDRAM
+
+  static void st7920_fb_send(u8g_t *u8g, u8g_dev_t *dev) {
+    uint8_t * const frame = u8g_dev_st7920_128x64_HAL_fb_buf;
+    auto word_changed = [&](const uint16_t i) {
+      return ((frame[i] ^ st7920_fb_sent[i]) | (frame[i + 1] ^ st7920_fb_sent[i + 1])) != 0;
+    };
+
+    bool selected = false;
+    LOOP_L_N(y, LCD_PIXEL_HEIGHT) {
+      const uint16_t row = y * FB_ROW_BYTES;
+      for (uint8_t w = 0; w < FB_ROW_WORDS;) {
+        if (!word_changed(row + w * 2)) { w++; continue; }
+
+        uint8_t e = w + 1;                          // Extend over the changed run
+        while (e < FB_ROW_WORDS && word_changed(row + e * 2)) e++;
+
+        if (!selected) {
+          u8g_SetAddress(u8g, dev, 0);              /* cmd mode */
+          u8g_SetChipSelect(u8g, dev, 1);
+          u8g_WriteByte(u8g, dev, 0x03E);           /* enable extended mode */
+          selected = true;
+        }
+
+        // The lower 32 rows are stored to the right of the upper 32
+        u8g_SetAddress(u8g, dev, 0);                /* cmd mode */
+        u8g_WriteByte(u8g, dev, 0x080 | (y & 0x1F));              /* y pos */
+        u8g_WriteByte(u8g, dev, 0x080 | (y < 32 ? 0 : 8) | w);    /* x pos in words */
+
+        uint8_t * const ptr = &frame[row + w * 2];
+        const uint8_t len = (e - w) * 2;
+        u8g_SetAddress(u8g, dev, 1);                /* data mode */
+        u8g_WriteSequence(u8g, dev, len, ptr);
+        memcpy(&st7920_fb_sent[row + w * 2], ptr, len);
+        w = e;
+      }
+    }
+    if (selected) u8g_SetChipSelect(u8g, dev, 0);
+  }
+
+  uint8_t u8g_dev_st7920_128x64_HAL_fb_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+    switch (msg) {
+      case U8G_DEV_MSG_INIT:
+        u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
+        u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7920_128x64_HAL_init_seq);
+        clear_graphics_DRAM(u8g, dev);
+        memset(st7920_fb_sent, 0, sizeof(st7920_fb_sent)); // GDRAM is now blank
+        break;
+
+      case U8G_DEV_MSG_STOP:
+        break;
+
+      case U8G_DEV_MSG_PAGE_FIRST:
+        // The pb8h1 clear only covers 8 rows
+        memset(u8g_dev_st7920_128x64_HAL_fb_buf, 0, sizeof(u8g_dev_st7920_128x64_HAL_fb_buf));
+        break;
+
+      case U8G_DEV_MSG_PAGE_NEXT:
+        st7920_fb_send(u8g, dev);
+        break;
+    }
+    return u8g_dev_pb8h1_base_fn(u8g, dev, msg, arg);
+  }
+
+  u8g_pb_t u8g_dev_st7920_128x64_HAL_fb_pb = { { LCD_PIXEL_HEIGHT, LCD_PIXEL_HEIGHT, 0, 0, 0 }, LCD_PIXEL_WIDTH, u8g_dev_st7920_128x64_HAL_fb_buf };
+  u8g_dev_t u8g_dev_st7920_128x64_HAL_fb_sw_spi = { u8g_dev_st7920_128x64_HAL_fb_fn, &u8g_dev_st7920_128x64_HAL_fb_pb, U8G_COM_ST7920_HAL_SW_SPI };
+  u8g_dev_t u8g_dev_st7920_128x64_HAL_fb_hw_spi = { u8g_dev_st7920_128x64_HAL_fb_fn, &u8g_dev_st7920_128x64_HAL_fb_pb, U8G_COM_ST7920_HAL_HW_SPI };
+
+#endif // ST7920_FRAMEBUFFER
+
 #endif // HAS_MARLINUI_U8GLIB
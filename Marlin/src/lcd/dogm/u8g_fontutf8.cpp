@@ -66,7 +66,7 @@ static const font_t* fontgroup_find(font_group_t * root, wchar_t val) {
 
   if (val < 256) return nullptr;
 
-  if (pf_bsearch_r((void*)root->m_fntifo, root->m_fntinfo_num, pf_bsearch_cb_comp_fntifo_pgm, (void*)&vcmp, &idx) < 0)
+  if (pf_bsearch_glyph((void*)root->m_fntifo, root->m_fntinfo_num, pf_bsearch_cb_comp_fntifo_pgm, (void*)&vcmp, &idx, val) < 0)
     return nullptr;
 
   memcpy_P(&vcmp, root->m_fntifo + idx, sizeof(vcmp));
@@ -304,11 +304,25 @@ int uxg_GetUtf8StrPixelWidthP(u8g_t *pu8g, PGM_P utf8_msg) {
 
   if (!uxg_Utf8FontIsInited()) return -1;
 
+  #ifdef LCD_GLYPH_CACHE
+    // ROM strings never change, and each language has its own, so the
+    // string and font pointers are enough to identify a width.
+    static struct { PGM_P str; const font_t *fnt; int width; } widths[8];
+    static uint8_t next_width = 0;
+    for (auto &w : widths) if (w.str == utf8_msg && w.fnt == fnt_default) return w.width;
+  #endif
+
   memset(&data, 0, sizeof(data));
   data.pu8g = pu8g;
   data.adv = 0;
   fontgroup_drawstring(group, fnt_default, utf8_msg, read_byte_rom, (void*)&data, fontgroup_cb_draw_u8gstrlen);
   u8g_SetFont(pu8g, (const u8g_fntpgm_uint8_t*)fnt_default);
+
+  #ifdef LCD_GLYPH_CACHE
+    widths[next_width] = { utf8_msg, fnt_default, int(data.adv) };
+    next_width = (next_width + 1) % COUNT(widths);
+  #endif
+
   return data.adv;
 }
 
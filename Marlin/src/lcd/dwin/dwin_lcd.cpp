@@ -109,6 +109,35 @@ bool DWINLCD::Handshake(void) {
         && databuf[3] == 'K' );
 }
 
+void DWINLCD::Handshake_Request(void) {
+  size_t i = 0;
+  recnum = 0;
+  ZERO(databuf);
+  DWIN_Byte(i, 0x00);
+  DWIN_Send(i);
+}
+
+// Collect whatever has arrived without waiting for more
+bool DWINLCD::Handshake_Reply(void) {
+  while (LCD_SERIAL.available() > 0 && recnum < (signed)sizeof(databuf)) {
+    databuf[recnum] = LCD_SERIAL.read();
+    if (databuf[0] != FHONE) {
+      if (recnum > 0) {
+        recnum = 0;
+        ZERO(databuf);
+      }
+      continue;
+    }
+    recnum++;
+  }
+
+  return ( recnum > 3
+        && databuf[0] == FHONE
+        && databuf[1] == '\0'
+        && databuf[2] == 'O'
+        && databuf[3] == 'K' );
+}
+
 // Set the backlight luminance
 //  luminance: (0x00-0xFF)
 void DWINLCD::Set_Backlight_Luminance(const uint8_t luminance) {
@@ -54,6 +54,9 @@ class DWINLCD{
 		/*-------------------------------------- System variable function --------------------------------------*/
 		// Handshake (1: Success, 0: Fail)
 		static bool Handshake(void);
+		// Non-blocking handshake: send the request, then poll until the reply is complete
+		static void Handshake_Request(void);
+		static bool Handshake_Reply(void);
 		// Common DWIN startup
 		static void Startup(void);
 		// Set the backlight luminance
@@ -49,6 +49,10 @@
   #include "../../../feature/fwretract.h"
 #endif
 
+#if ENABLED(JOB_ANALYZER)
+  #include "../../../feature/job_analyzer.h"
+#endif
+
 #include <WString.h>
 #include <stdio.h>
 #include <string.h>
@@ -3826,6 +3830,16 @@ void HMI_SDCardUpdate() {
 	}
 }
 
+#if ENABLED(JOB_ANALYZER)
+// Pre-scan the highlighted file while the list is shown
+static void Analyze_Selected_File() {
+ const uint16_t hasUpDir = !card.flag.workDirIsRoot;
+ if (select_file.now < 1 + hasUpDir) return;
+ card.getfilename_sorted(SD_ORDER(select_file.now - 1 - hasUpDir, card.get_num_Files()));
+ if (!card.flag.filenameIsDir) job_analyzer.select(card.filename);
+}
+#endif
+
 // Select (and Print) File
 void HMI_SelectFile() {
  ENCODER_DiffState encoder_diffState = get_encoder_state();
@@ -3876,6 +3890,7 @@ void HMI_SelectFile() {
     TERN_(SCROLL_LONG_FILENAMES, Init_Shift_Name());     // ...and init the shift name
    }
    TERN_(SCROLL_LONG_FILENAMES, Init_SDItem_Shift());
+   TERN_(JOB_ANALYZER, Analyze_Selected_File());
   }
  }
  else if (encoder_diffState == ENCODER_DIFF_CCW && fullCnt) {
@@ -3902,6 +3917,7 @@ void HMI_SelectFile() {
     TERN_(SCROLL_LONG_FILENAMES, Init_Shift_Name());    // ...and init the shift name
    }
    TERN_(SCROLL_LONG_FILENAMES, Init_SDItem_Shift());    // Reset left. Init timer.
+   TERN_(JOB_ANALYZER, Analyze_Selected_File());
   }
  }
  else if (encoder_diffState == ENCODER_DIFF_ENTER) {
@@ -6469,20 +6485,31 @@ void HMI_StepPermm() {
  dwinLCD.UpdateLCD();
 }
 
-void HMI_Init() {
+void HMI_InitStart() {
 	Encoder_Configuration();
-	
 	dwinLCD.JPG_ShowAndCache(0);
+}
+
+void HMI_ShowBootProgress(const uint8_t percent) {
+	DWIN_Show_ICON( ICON_Bar, 15, 260);
+	dwinLCD.Draw_Rectangle(1, Color_Bg_Black, 15 + percent * 242 / 100, 260, 257, 280);
+	dwinLCD.UpdateLCD();
+}
+
+void HMI_InitFinish() {
+	HMI_SetLanguage();
+	HMI_StartFrame(true);
+}
+
+void HMI_Init() {
+	HMI_InitStart();
 	HMI_SDCardInit();
 
-	for (uint16_t t = 0; t <= 100; t += 2) {
-		DWIN_Show_ICON( ICON_Bar, 15, 260);
-		dwinLCD.Draw_Rectangle(1, Color_Bg_Black, 15 + t * 242 / 100, 260, 257, 280);
-		dwinLCD.UpdateLCD();
+	for (uint8_t t = 0; t <= 100; t += 2) {
+		HMI_ShowBootProgress(t);
 		delay(20);
 	}
-	HMI_SetLanguage();
-	HMI_StartFrame(true);
+	HMI_InitFinish();
 }
 
 #if ENABLED(DEBUG_GCODE_M92)
@@ -6609,6 +6636,30 @@ inline void _check_Powerloss_resume(){
 }
 #endif//(ENABLED(POWER_LOSS_RECOVERY))
 
+#if BOTH(OPTION_WIFI_MODULE, SD_UPLOAD_STREAM)
+// Show the upload rate on the Wi-Fi screen while a file is saved
+inline void _check_upload(){
+	// Only shown on the Wi-Fi screen, never drawn over another menu
+	static bool shown = false;
+	if(!card.flag.saving || card.flag.logging || DwinMenuID != DWMENU_SET_WIFIONOFF){
+		shown = false;
+		return;
+	}
+	if(!shown){
+		shown = true;
+		Clear_Main_Window();
+		Draw_Popup_Bkgd_60();
+		Draw_Popup_Bkgd_Wifi();
+		Draw_Title(F("WIFI"));
+		Draw_Wifi_Title("Upload");
+		DWIN_Show_ICON( ICON_Confirm_E, 86, 231);
+	}
+	char str[16];
+	sprintf_P(str, PSTR("%6lu KB/s"), (unsigned long)(card.upload_rate() / 1024));
+	dwinLCD.Draw_String(false, true, FIL.Font, FIL.Text_Color, FIL.Window_Color, (DWIN_WIDTH - FIL.Font_W * strlen(str)) / 2, 168, str);
+}
+#endif
+
 #if ENABLED(OPTION_WIFI_MODULE)
 inline void _check_wifi(){
 	if(WiFi_Enabled){
@@ -7270,7 +7321,13 @@ inline void _Update_printing_Timer(){
 		// Estimate remaining time every 20 seconds
 		const millis_t ms = millis();	
 		static millis_t next_remain_time_update = 0;
-		if(HMI_ValueStruct.Percentrecord >= 1 && ELAPSED(ms, next_remain_time_update) && !HMI_flag.heat_flag) {
+		if((HMI_ValueStruct.Percentrecord >= 1 || TERN0(JOB_ANALYZER, job_analyzer.matchesPrint())) && ELAPSED(ms, next_remain_time_update) && !HMI_flag.heat_flag) {
+			#if ENABLED(JOB_ANALYZER)
+			 // From the pre-scan estimate, if there is one
+			 if (job_analyzer.matchesPrint())
+			 	HMI_ValueStruct.remain_time = _MIN(job_analyzer.remaining(card.getIndex(), elapsed.value - HMI_ValueStruct.dwin_heat_time), 0xFFFFUL);
+			 else
+			#endif
 			 HMI_ValueStruct.remain_time = (((elapsed.value - HMI_ValueStruct.dwin_heat_time) * 100) / HMI_ValueStruct.Percentrecord) - (elapsed.value - HMI_ValueStruct.dwin_heat_time);
 			 next_remain_time_update += 20 * 1000UL;
 			 if(DwinMenuID == DWMENU_PRINTING) Draw_Print_ProgressRemain();
@@ -7339,6 +7396,11 @@ void EachMomentUpdate() {
 	
 	// variable update
  	update_variable();
+
+	// Only scan files while the file list is shown
+	#if ENABLED(JOB_ANALYZER)
+	if (DwinMenuID != DWMENU_FILE && job_analyzer.isScanning()) job_analyzer.cancel();
+	#endif
 	
 	if(DWIN_status == ID_SM_START){
 		//check resume print when power on
@@ -7348,6 +7410,9 @@ void EachMomentUpdate() {
 	else if(DWIN_status == ID_SM_IDEL){	  
 		//check WiFi
 		TERN_(OPTION_WIFI_MODULE, _check_wifi());				
+		#if BOTH(OPTION_WIFI_MODULE, SD_UPLOAD_STREAM)
+			_check_upload();
+		#endif
 		TERN_(POWER_LOSS_RECOVERY, _check_Powerloss_resume());
 	}
 	else if(DWIN_status == ID_SM_PRINTING){
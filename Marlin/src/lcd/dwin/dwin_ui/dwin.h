@@ -772,6 +772,9 @@ void HMI_MaxJerk();         // Maximum jerk speed submenu
 void HMI_StepPermm();            // Transmission ratio
 
 void HMI_Init();
+void HMI_InitStart();
+void HMI_ShowBootProgress(const uint8_t percent);
+void HMI_InitFinish();
 void DWIN_Update();
 void EachMomentUpdate();
 void DWIN_HandleScreen();
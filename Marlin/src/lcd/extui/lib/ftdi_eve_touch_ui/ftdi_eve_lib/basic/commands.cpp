@@ -901,6 +901,7 @@ void CLCD::CommandFifo::start() {
 }
 
 void CLCD::CommandFifo::execute() {
+  flush();
   if (command_write_ptr != 0xFFFFFFFFul) {
     mem_write_32(REG::CMD_WRITE, command_write_ptr);
   }
@@ -914,6 +915,9 @@ void CLCD::CommandFifo::reset() {
   mem_write_32(REG::CPURESET,  0x00000000);
   safe_delay(300);
   command_write_ptr = 0xFFFFFFFFul;
+  #ifdef TOUCH_UI_CMD_BATCH_SIZE
+    batch_used = 0;
+  #endif
 };
 
 template <class T> bool CLCD::CommandFifo::_write_unaligned(T data, uint16_t len) {
@@ -969,7 +973,7 @@ template <class T> bool CLCD::CommandFifo::_write_unaligned(T data, uint16_t len
 // divisible by four, zero bytes will be written
 // to align to the boundary.
 
-template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+template <class T> bool CLCD::CommandFifo::_write(T data, uint16_t len) {
   const uint8_t padding = MULTIPLE_OF_4(len) - len;
 
   uint8_t pad_bytes[] = {0, 0, 0, 0};
@@ -981,6 +985,7 @@ void CLCD::CommandFifo::start() {
 }
 
 void CLCD::CommandFifo::execute() {
+  flush();
 }
 
 void CLCD::CommandFifo::reset() {
@@ -993,13 +998,16 @@ void CLCD::CommandFifo::reset() {
   mem_write_32(REG::CMD_READ,  0x00000000);
   mem_write_32(REG::CPURESET,  0x00000000);
   safe_delay(300);
+  #ifdef TOUCH_UI_CMD_BATCH_SIZE
+    batch_used = 0;
+  #endif
 };
 
 // Writes len bytes into the FIFO, if len is not
 // divisible by four, zero bytes will be written
 // to align to the boundary.
 
-template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+template <class T> bool CLCD::CommandFifo::_write(T data, uint16_t len) {
   const uint8_t padding = MULTIPLE_OF_4(len) - len;
 
   if (has_fault()) {
@@ -1036,8 +1044,44 @@ template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
 }
 #endif
 
-template bool CLCD::CommandFifo::write(const void*, uint16_t);
-template bool CLCD::CommandFifo::write(progmem_str, uint16_t);
+template bool CLCD::CommandFifo::_write(const void*, uint16_t);
+template bool CLCD::CommandFifo::_write(progmem_str, uint16_t);
+
+#ifdef TOUCH_UI_CMD_BATCH_SIZE
+
+  // Commands are collected in RAM, already padded, and sent to the
+  // FIFO in one burst by flush(). The FIFO is a single stream, so all
+  // CommandFifo objects share the batch.
+
+  uint8_t  CLCD::CommandFifo::batch[TOUCH_UI_CMD_BATCH_SIZE];
+  uint16_t CLCD::CommandFifo::batch_used = 0;
+
+  static inline void batch_copy(uint8_t *dst, const void *src, uint16_t len) { memcpy(dst, src, len); }
+  static inline void batch_copy(uint8_t *dst, progmem_str src, uint16_t len) { memcpy_P(dst, (const char*)src, len); }
+
+  template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
+    const uint16_t padded = MULTIPLE_OF_4(len);
+    if (batch_used + padded > sizeof(batch)) {
+      if (!flush()) return false;
+      if (padded > sizeof(batch)) return _write(data, len); // Too big to batch
+    }
+    batch_copy(&batch[batch_used], data, len);
+    ::memset(&batch[batch_used + len], 0, padded - len);
+    batch_used += padded;
+    return true;
+  }
+
+  bool CLCD::CommandFifo::flush() {
+    if (!batch_used) return true;
+    const uint16_t len = batch_used;
+    batch_used = 0;
+    return _write((const void*)batch, len);
+  }
+
+  template bool CLCD::CommandFifo::write(const void*, uint16_t);
+  template bool CLCD::CommandFifo::write(progmem_str, uint16_t);
+
+#endif // TOUCH_UI_CMD_BATCH_SIZE
 
 // CO_PROCESSOR COMMANDS
 
@@ -178,15 +178,27 @@ class CLCD::CommandFifo {
       uint32_t getRegCmdBSpace();
     #else
       static uint32_t command_write_ptr;
-      template <class T> bool _write_unaligned(T data, uint16_t len);
+      template <class T> static bool _write_unaligned(T data, uint16_t len);
+    #endif
+    #ifdef TOUCH_UI_CMD_BATCH_SIZE
+      static uint8_t  batch[TOUCH_UI_CMD_BATCH_SIZE];
+      static uint16_t batch_used;
     #endif
     void start();
+    template <class T> static bool _write(T data, uint16_t len);
 
   public:
-    template <class T> bool write(T data, uint16_t len);
+    #ifdef TOUCH_UI_CMD_BATCH_SIZE
+      template <class T> bool write(T data, uint16_t len);
+      static bool flush();
+    #else
+      template <class T> bool write(T data, uint16_t len) {return _write(data, len);}
+      static bool flush() {return true;}
+    #endif
 
   public:
     CommandFifo() {start();}
+    ~CommandFifo() {flush();}
 
     static void reset();
     static bool is_processing();
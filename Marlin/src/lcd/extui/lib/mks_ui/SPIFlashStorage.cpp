@@ -27,6 +27,10 @@
 #include "../../../../inc/MarlinConfig.h"
 #include "SPIFlashStorage.h"
 
+//#define DEBUG_SPI_FLASH_CACHE
+#define DEBUG_OUT ENABLED(DEBUG_SPI_FLASH_CACHE)
+#include "../../../../core/debug_out.h"
+
 extern W25QXXFlash W25QXX;
 
 uint8_t SPIFlashStorage::m_pageData[SPI_FLASH_PageSize];
@@ -144,7 +148,17 @@ uint32_t SPIFlashStorage::m_startAddress;
 
 #endif // HAS_SPI_FLASH_COMPRESSION
 
+#ifdef SPI_FLASH_IMAGE_CACHE
+  SPIFlashStorage::cacheBlock_t SPIFlashStorage::m_cache[SPI_FLASH_IMAGE_CACHE];
+  uint32_t SPIFlashStorage::m_cacheTick, SPIFlashStorage::m_readOffset, SPIFlashStorage::m_decodedOffset;
+  uint32_t SPIFlashStorage::cacheHits, SPIFlashStorage::cacheMisses;
+#endif
+
 void SPIFlashStorage::beginWrite(uint32_t startAddress) {
+  #ifdef SPI_FLASH_IMAGE_CACHE
+    // The flash contents are changing
+    for (auto &b : m_cache) b.lastUse = 0;
+  #endif
   m_pageDataUsed = 0;
   m_currentPage = 0;
   m_startAddress = startAddress;
@@ -283,7 +297,18 @@ void SPIFlashStorage::writeData(uint8_t* data, uint16_t size) {
 }
 
 void SPIFlashStorage::beginRead(uint32_t startAddress) {
+  #ifdef SPI_FLASH_IMAGE_CACHE
+    if (startAddress != m_startAddress) DEBUG_ECHOLNPAIR("SPI Flash cache hits:", cacheHits, " misses:", cacheMisses);
+    m_readOffset = 0;
+  #endif
   m_startAddress = startAddress;
+  restartDecode();
+}
+
+void SPIFlashStorage::restartDecode() {
+  #ifdef SPI_FLASH_IMAGE_CACHE
+    m_decodedOffset = 0;
+  #endif
   m_currentPage = 0;
   // Nothing in memory now
   m_pageDataUsed = SPI_FLASH_PageSize;
@@ -300,7 +325,66 @@ uint16_t SPIFlashStorage::outData(uint8_t* data, uint16_t size) {
   return size;
 }
 
-void SPIFlashStorage::readData(uint8_t* data, uint16_t size) {
+#ifdef SPI_FLASH_IMAGE_CACHE
+
+  /**
+   * Get the cache block holding the first 'length' bytes of the given block
+   * of data from the current start address. Only what was asked for is
+   * decoded, so reads never run past the end of the stored data.
+   * On a miss the least recently used block is refilled, restarting the
+   * decoder if it is already past the data.
+   */
+  SPIFlashStorage::cacheBlock_t* SPIFlashStorage::cacheBlock(uint32_t block, uint16_t length) {
+    cacheBlock_t *b = nullptr, *victim = &m_cache[0];
+    for (auto &c : m_cache) {
+      if (c.lastUse && c.startAddress == m_startAddress && c.block == block) { b = &c; break; }
+      if (c.lastUse < victim->lastUse) victim = &c;
+    }
+
+    if (b && b->length >= length)
+      cacheHits++;
+    else {
+      cacheMisses++;
+      if (!b) {
+        b = victim;
+        b->startAddress = m_startAddress;
+        b->block = block;
+        b->length = 0;
+      }
+      const uint32_t offset = block * cacheBlockSize + b->length;
+      if (m_decodedOffset > offset) restartDecode();
+      while (m_decodedOffset < offset)        // Skip data that is already cached
+        decodeData(b->data + b->length, _MIN(offset - m_decodedOffset, uint32_t(cacheBlockSize - b->length)));
+      decodeData(b->data + b->length, length - b->length);
+      b->length = length;
+    }
+
+    b->lastUse = ++m_cacheTick;
+    return b;
+  }
+
+  void SPIFlashStorage::readData(uint8_t* data, uint16_t size) {
+    while (size > 0) {
+      const uint16_t in_block = m_readOffset % cacheBlockSize,
+                     count = _MIN(size, uint16_t(cacheBlockSize - in_block));
+      memcpy(data, cacheBlock(m_readOffset / cacheBlockSize, in_block + count)->data + in_block, count);
+      m_readOffset += count;
+      data += count;
+      size -= count;
+    }
+  }
+
+#else
+
+  void SPIFlashStorage::readData(uint8_t* data, uint16_t size) { decodeData(data, size); }
+
+#endif
+
+void SPIFlashStorage::decodeData(uint8_t* data, uint16_t size) {
+  #ifdef SPI_FLASH_IMAGE_CACHE
+    m_decodedOffset += size;
+  #endif
+
   // Read a page if needed
   if (pageDataFree() == 0) readPage();
 
@@ -61,6 +61,11 @@
  *    while (there is data to read)
  *      SPIFlashStorage.readData(myBuffer, bufferSize);
  *
+ * With SPI_FLASH_IMAGE_CACHE the uncompressed data is also kept in
+ * 1KB blocks, keyed by start address and offset. Reading the same
+ * data again is then a copy from RAM. The least recently used block
+ * is replaced when the cache is full, and any write clears it.
+ *
  * Compression:
  *
  * The biggest advantage of this class is the RLE compression.
@@ -85,6 +90,10 @@ public:
 
   static uint32_t getCurrentPage() { return m_currentPage; }
 
+  #ifdef SPI_FLASH_IMAGE_CACHE
+    static uint32_t cacheHits, cacheMisses;
+  #endif
+
 private:
   static void flushPage();
   static void savePage(uint8_t* buffer);
@@ -92,6 +101,8 @@ private:
   static void readPage();
   static uint16_t inData(uint8_t* data, uint16_t size);
   static uint16_t outData(uint8_t* data, uint16_t size);
+  static void decodeData(uint8_t* data, uint16_t size);
+  static void restartDecode();
 
   static uint8_t m_pageData[SPI_FLASH_PageSize];
   static uint32_t m_currentPage;
@@ -103,6 +114,21 @@ private:
     static uint16_t m_compressedDataUsed;
     static inline uint16_t compressedDataFree() { return SPI_FLASH_PageSize - m_compressedDataUsed; }
   #endif
+
+  #ifdef SPI_FLASH_IMAGE_CACHE
+    static constexpr uint16_t cacheBlockSize = 1024;
+    typedef struct {
+      uint32_t startAddress, block;   // What the data is
+      uint32_t lastUse;               // For LRU replacement, 0 if empty
+      uint16_t length;                // Bytes decoded so far
+      uint8_t data[cacheBlockSize];
+    } cacheBlock_t;
+    static cacheBlock_t m_cache[SPI_FLASH_IMAGE_CACHE];
+    static uint32_t m_cacheTick;
+    static uint32_t m_readOffset,     // Offset requested by readData
+                    m_decodedOffset;  // Offset the page decoder has reached
+    static cacheBlock_t* cacheBlock(uint32_t block, uint16_t length);
+  #endif
 };
 
 extern SPIFlashStorage SPIFlash;
@@ -73,6 +73,53 @@ int pf_bsearch_r(void *userdata, size_t num_data, pf_bsearch_cb_comp_t cb_comp,
   return -1;
 }
 
+#ifdef LCD_GLYPH_CACHE
+
+  typedef struct {
+    const void *table;
+    wchar_t key;
+    int16_t idx;    // Position in the table, or -1 if not there
+  } glyph_cache_t;
+
+  // Most recently used first
+  static glyph_cache_t glyph_cache[LCD_GLYPH_CACHE];
+  static uint8_t glyph_cache_count = 0;
+
+  /**
+   * @brief pf_bsearch_r with the result remembered per table and code point
+   *
+   * @param key : the code point that data_pinpoint was made from
+   *
+   * The entry found moves to the front. A miss is searched, then added
+   * at the front, dropping the least recently used entry when full.
+   * Code points that aren't in the table are remembered too.
+   */
+  int pf_bsearch_cached(void *userdata, size_t num_data, pf_bsearch_cb_comp_t cb_comp, void *data_pinpoint, size_t *ret_idx, const wchar_t key) {
+    uint8_t i = 0;
+    while (i < glyph_cache_count && (glyph_cache[i].key != key || glyph_cache[i].table != userdata)) i++;
+
+    glyph_cache_t entry;
+    if (i < glyph_cache_count)
+      entry = glyph_cache[i];
+    else {
+      size_t idx = 0;
+      entry.table = userdata;
+      entry.key = key;
+      entry.idx = pf_bsearch_r(userdata, num_data, cb_comp, data_pinpoint, &idx) < 0 ? -1 : int16_t(idx);
+      if (glyph_cache_count < LCD_GLYPH_CACHE) glyph_cache_count++;
+      i = glyph_cache_count - 1;
+    }
+
+    for (; i; i--) glyph_cache[i] = glyph_cache[i - 1];
+    glyph_cache[0] = entry;
+
+    if (entry.idx < 0) return -1;
+    *ret_idx = entry.idx;
+    return 0;
+  }
+
+#endif // LCD_GLYPH_CACHE
+
 /* This function gets the character at the pstart position, interpreting UTF8 multibyte sequences
    and returns the pointer to the next character */
 uint8_t* get_utf8_value_cb(uint8_t *pstart, read_byte_cb_t cb_read_byte, wchar_t *pval) {
@@ -35,6 +35,19 @@ typedef uint16_t pixel_len_t;
 typedef int (* pf_bsearch_cb_comp_t)(void *userdata, size_t idx, void * data_pin); /*"data_list[idx] - *data_pin"*/
 int pf_bsearch_r(void *userdata, size_t num_data, pf_bsearch_cb_comp_t cb_comp, void *data_pinpoint, size_t *ret_idx);
 
+/* Binary search for a code point, through the glyph cache if enabled */
+#ifdef LCD_GLYPH_CACHE
+  int pf_bsearch_cached(void *userdata, size_t num_data, pf_bsearch_cb_comp_t cb_comp, void *data_pinpoint, size_t *ret_idx, const uint32_t key);
+#endif
+inline int pf_bsearch_glyph(void *userdata, size_t num_data, pf_bsearch_cb_comp_t cb_comp, void *data_pinpoint, size_t *ret_idx, const uint32_t key) {
+  #ifdef LCD_GLYPH_CACHE
+    return pf_bsearch_cached(userdata, num_data, cb_comp, data_pinpoint, ret_idx, key);
+  #else
+    UNUSED(key);
+    return pf_bsearch_r(userdata, num_data, cb_comp, data_pinpoint, ret_idx);
+  #endif
+}
+
 /* Get the character, decoding multibyte UTF8 characters and returning a pointer to the start of the next UTF8 character */
 uint8_t* get_utf8_value_cb(uint8_t *pstart, read_byte_cb_t cb_read_byte, wchar_t *pval);
 
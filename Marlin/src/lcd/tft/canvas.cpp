@@ -85,6 +85,9 @@ void CANVAS::AddImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors)
            image_height = Images[image].height;
   colorMode_t color_mode = Images[image].colorMode;
 
+  if (color_mode == GREYSCALE4_RLE || color_mode == HIGHCOLOR_RLE)
+    return AddImageRLE(x, y, image_width, image_height, color_mode, data, colors);
+
   if (color_mode != HIGHCOLOR)
     return AddImage(x, y, image_width, image_height, color_mode, (uint8_t *)data, colors);
 
@@ -143,6 +146,53 @@ void CANVAS::AddImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_h
   }
 }
 
+/**
+ * Decode a run-length encoded image straight into the canvas lines.
+ * See buildroot/share/scripts/gen-tft-rle-image.py for the format.
+ * Runs continue across image rows. Solid runs become plain fills,
+ * transparent runs are skipped, and decoding stops below the last line.
+ */
+void CANVAS::AddImageRLE(int16_t x, int16_t y, uint16_t image_width, uint16_t image_height, colorMode_t color_mode, void *data, uint16_t *colors) {
+  const uint8_t *rle4 = (uint8_t *)data;
+  const uint16_t *rle16 = (uint16_t *)data;
+  uint16_t row = 0, col = 0;
+
+  while (row < image_height) {
+    uint16_t count, color = 0;
+    bool literal = false, transparent = false;
+
+    if (color_mode == GREYSCALE4_RLE) {
+      const uint8_t run = *rle4++, index = run & 0x0F;
+      count = (run >> 4) + 1;
+      if (index) color = colors[index - 1]; else transparent = true;
+    }
+    else {
+      const uint16_t token = *rle16++;
+      count = (token & 0x7FFF) + 1;
+      if (token & 0x8000) color = *rle16++; else literal = true;
+    }
+
+    while (count) {
+      const int16_t line = y + row;
+      if (line >= endLine) return;
+
+      const uint16_t n = _MIN(count, image_width - col);
+      if (!transparent && line >= startLine) {
+        const int16_t left = x + col, from = _MAX(left, 0), to = _MIN(left + n, width);
+        uint16_t *pixel = buffer + (line - startLine) * width + from;
+        if (literal)
+          for (int16_t i = from; i < to; i++) *pixel++ = rle16[i - left];
+        else
+          for (int16_t i = from; i < to; i++) *pixel++ = color;
+      }
+      if (literal) rle16 += n;
+      count -= n;
+      col += n;
+      if (col == image_width) { col = 0; row++; }
+    }
+  }
+}
+
 void CANVAS::AddRectangle(uint16_t x, uint16_t y, uint16_t rectangleWidth, uint16_t rectangleHeight, uint16_t color) {
   if (endLine < y || startLine > y + rectangleHeight) return;
 
@@ -40,6 +40,7 @@ class CANVAS {
 
     static void AddImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors);
     static void AddImage(uint16_t x, uint16_t y, uint16_t imageWidth, uint16_t imageHeight, uint16_t color, uint16_t bgColor, uint8_t *image);
+    static void AddImageRLE(int16_t x, int16_t y, uint16_t image_width, uint16_t image_height, colorMode_t color_mode, void *data, uint16_t *colors);
 
   public:
     static void New(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
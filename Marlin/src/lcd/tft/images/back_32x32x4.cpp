@@ -24,39 +24,24 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t back_32x32x4[512] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x75, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x66, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x76, 0xE5, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x6F, 0xE5, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x76, 0xFF, 0xE5, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x6E, 0xFF, 0xE5, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x76, 0xEF, 0xFF, 0xE5, 0x66, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x6E, 0xFF, 0xFF, 0xD5, 0x55, 0x66, 0x67, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x76, 0xFF, 0xFF, 0xFF, 0xFE, 0xB8, 0x55, 0x56, 0x67, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x87, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x85, 0x56, 0x67, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x66, 0x78, 0x88, 0x88, 0x88,
-  0x87, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x65, 0x66, 0x88, 0x88, 0x88,
-  0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x56, 0x78, 0x88, 0x88,
-  0x78, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x67, 0x88, 0x88,
-  0x87, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x56, 0x78, 0x88,
-  0x88, 0x77, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x65, 0x68, 0x88,
-  0x88, 0x87, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x67, 0x88,
-  0x88, 0x88, 0x77, 0xEF, 0xFF, 0xFF, 0xFC, 0xDE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x56, 0x88,
-  0x88, 0x88, 0x87, 0x7E, 0xFF, 0xFF, 0xD5, 0x67, 0x77, 0x8A, 0xDF, 0xFF, 0xFF, 0xFF, 0x56, 0x78,
-  0x88, 0x88, 0x88, 0x77, 0xEF, 0xFF, 0xE5, 0x78, 0x87, 0x77, 0x77, 0xAE, 0xFF, 0xFF, 0x95, 0x68,
-  0x88, 0x88, 0x88, 0x87, 0x7E, 0xFF, 0xE5, 0x78, 0x88, 0x88, 0x88, 0x77, 0xAF, 0xFF, 0xF5, 0x58,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0xEF, 0xE5, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0xDF, 0xF8, 0x57,
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x7F, 0xE6, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7B, 0xFC, 0x56,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xD7, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xBF, 0x66,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7D, 0x97,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x97,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+extern const uint8_t back_32x32x4[261] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0xC8, 0x07, 0xF8, 0xD8, 0x07, 0x05, 0x07, 0xF8, 0xB8, 0x07, 0x16, 0x07,
+  0xF8, 0xA8, 0x07, 0x06, 0x0E, 0x05, 0x07, 0xF8, 0x98, 0x07, 0x06, 0x0F, 0x0E, 0x05, 0x07, 0xF8,
+  0x88, 0x07, 0x06, 0x1F, 0x0E, 0x05, 0x07, 0xF8, 0x78, 0x07, 0x06, 0x0E, 0x1F, 0x0E, 0x05, 0x07,
+  0xF8, 0x68, 0x07, 0x06, 0x0E, 0x2F, 0x0E, 0x05, 0x16, 0x17, 0xF8, 0x28, 0x07, 0x06, 0x0E, 0x3F,
+  0x0D, 0x25, 0x26, 0x07, 0xF8, 0x07, 0x06, 0x6F, 0x0E, 0x0B, 0x08, 0x25, 0x16, 0x07, 0xC8, 0x07,
+  0x06, 0xBF, 0x0D, 0x08, 0x15, 0x16, 0x07, 0x98, 0x07, 0x06, 0xFF, 0x09, 0x05, 0x16, 0x07, 0x78,
+  0x17, 0xFF, 0x1F, 0x0D, 0x06, 0x05, 0x16, 0x58, 0x07, 0x08, 0xFF, 0x4F, 0x07, 0x05, 0x06, 0x07,
+  0x48, 0x07, 0x08, 0x0E, 0xFF, 0x4F, 0x08, 0x05, 0x06, 0x07, 0x48, 0x07, 0x08, 0x0E, 0xFF, 0x4F,
+  0x07, 0x05, 0x06, 0x07, 0x48, 0x17, 0x0E, 0xFF, 0x4F, 0x06, 0x05, 0x06, 0x58, 0x07, 0x08, 0x0E,
+  0xFF, 0x3F, 0x0D, 0x05, 0x06, 0x07, 0x58, 0x17, 0x0E, 0x5F, 0x0C, 0x0D, 0x1E, 0x9F, 0x09, 0x05,
+  0x06, 0x68, 0x17, 0x0E, 0x3F, 0x0D, 0x05, 0x06, 0x27, 0x08, 0x0A, 0x0D, 0x6F, 0x05, 0x06, 0x07,
+  0x68, 0x17, 0x0E, 0x2F, 0x0E, 0x05, 0x07, 0x18, 0x47, 0x0A, 0x0E, 0x3F, 0x09, 0x05, 0x06, 0x78,
+  0x17, 0x0E, 0x1F, 0x0E, 0x05, 0x07, 0x68, 0x17, 0x0A, 0x3F, 0x15, 0x88, 0x17, 0x0E, 0x0F, 0x0E,
+  0x05, 0x07, 0x88, 0x17, 0x0D, 0x1F, 0x08, 0x05, 0x07, 0x88, 0x17, 0x0F, 0x0E, 0x06, 0x07, 0x98,
+  0x17, 0x0B, 0x0F, 0x0C, 0x05, 0x06, 0x98, 0x17, 0x0D, 0x07, 0xB8, 0x17, 0x0B, 0x0F, 0x16, 0xA8,
+  0x07, 0xE8, 0x17, 0x0D, 0x09, 0x07, 0xB8, 0x07, 0xE8, 0x07, 0x08, 0x09, 0x07, 0xF8, 0xC8, 0x17,
+  0xF8, 0xF8, 0xF8, 0xF8, 0x08
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -24,59 +24,51 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t btn_rounded_64x52x4[1664] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88,
-  0x88, 0x88, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x87, 0x77, 0x78,
-  0x88, 0x78, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x66, 0x78,
-  0x88, 0x8D, 0xFF, 0xB8, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x7B, 0xFF, 0xC6, 0x67,
-  0x87, 0xBF, 0xF7, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x6F, 0xF9, 0x56,
-  0x87, 0xEF, 0x84, 0x44, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0xFD, 0x46,
-  0x87, 0xFF, 0x54, 0x44, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xFF, 0x45,
-  0x87, 0xFF, 0x44, 0x45, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xFF, 0x45,
-  0x87, 0xFF, 0x44, 0x56, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xFF, 0x44, 0x56, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xFF, 0x44,
-  0x87, 0xEF, 0x84, 0x56, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xFE, 0x44,
-  0x87, 0xAF, 0xF6, 0x56, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x9F, 0xF9, 0x44,
-  0x87, 0x7D, 0xFF, 0xB8, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x9C, 0xFF, 0xD4, 0x45,
-  0x87, 0x76, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x54, 0x45,
-  0x87, 0x76, 0x56, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x64, 0x44, 0x46,
-  0x87, 0x77, 0x65, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x56,
-  0x88, 0x77, 0x76, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x67,
-  0x88, 0x77, 0x77, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x78,
-  0x88, 0x88, 0x77, 0x77, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x78,
+extern const uint8_t btn_rounded_64x52x4[692] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0x58, 0xF7, 0xF7, 0xF7, 0x77, 0x58, 0x07, 0x09, 0x0C, 0x0E, 0xFF, 0xFF,
+  0xFF, 0x0E, 0x0B, 0x08, 0x37, 0x28, 0x07, 0x08, 0x0C, 0xFF, 0xFF, 0xFF, 0x5F, 0x0B, 0x16, 0x07,
+  0x38, 0x0D, 0x1F, 0x0B, 0x08, 0x05, 0xF4, 0xF4, 0xD4, 0x05, 0x07, 0x0B, 0x1F, 0x0C, 0x16, 0x07,
+  0x08, 0x07, 0x0B, 0x1F, 0x07, 0xF4, 0xF4, 0xF4, 0x34, 0x06, 0x1F, 0x09, 0x05, 0x06, 0x08, 0x07,
+  0x0E, 0x0F, 0x08, 0x34, 0xF5, 0xF5, 0xF5, 0x15, 0x08, 0x0F, 0x0D, 0x04, 0x06, 0x08, 0x07, 0x1F,
+  0x05, 0x24, 0x05, 0xF6, 0xF6, 0xF6, 0x26, 0x1F, 0x04, 0x05, 0x08, 0x07, 0x1F, 0x24, 0x05, 0x06,
+  0xF7, 0xF7, 0xF7, 0x17, 0x06, 0x1F, 0x04, 0x05, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x37, 0xF8,
+  0xF8, 0xB8, 0x37, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x17, 0xF8, 0xF8, 0xF8, 0x17,
+  0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14,
+  0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07,
+  0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14,
+  0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06,
+  0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8,
+  0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8,
+  0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07,
+  0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14,
+  0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07,
+  0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14,
+  0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06,
+  0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8,
+  0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8,
+  0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07,
+  0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14,
+  0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07,
+  0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14,
+  0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06,
+  0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8,
+  0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8,
+  0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07,
+  0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14,
+  0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07,
+  0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14,
+  0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06,
+  0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8,
+  0xF8, 0xF8, 0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8,
+  0x18, 0x07, 0x1F, 0x14, 0x08, 0x07, 0x1F, 0x14, 0x05, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0x18, 0x07,
+  0x1F, 0x14, 0x08, 0x07, 0x0E, 0x0F, 0x08, 0x04, 0x05, 0x06, 0x17, 0xF8, 0xF8, 0xF8, 0x07, 0x0A,
+  0x0F, 0x0E, 0x14, 0x08, 0x07, 0x0A, 0x1F, 0x06, 0x05, 0x06, 0x37, 0xF8, 0xF8, 0xB8, 0x17, 0x09,
+  0x1F, 0x09, 0x14, 0x08, 0x17, 0x0D, 0x1F, 0x0B, 0x08, 0xF7, 0xF7, 0xE7, 0x08, 0x09, 0x0C, 0x1F,
+  0x0D, 0x14, 0x05, 0x08, 0x17, 0x06, 0x0B, 0xFF, 0xFF, 0xFF, 0x5F, 0x0B, 0x05, 0x14, 0x05, 0x08,
+  0x17, 0x06, 0x05, 0x06, 0x0A, 0x0D, 0xFF, 0xFF, 0xFF, 0x0D, 0x0B, 0x06, 0x34, 0x06, 0x08, 0x27,
+  0x06, 0x05, 0xF4, 0xF4, 0xF4, 0x74, 0x05, 0x06, 0x18, 0x27, 0x06, 0x15, 0xF4, 0xF4, 0xF4, 0x34,
+  0x15, 0x06, 0x07, 0x18, 0x37, 0x26, 0xF5, 0xF5, 0xF5, 0x15, 0x26, 0x07, 0x48, 0x47, 0xF6, 0xF6,
+  0xF6, 0x16, 0x37, 0x08
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -24,138 +24,128 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t fan_slow0_64x64x4[2048] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x9A, 0xBB, 0xBB, 0xAA, 0x99, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0xAB, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xDB, 0x97, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xAC, 0xCB, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xBC, 0xBB, 0xBB, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8A, 0xCB, 0xBB, 0xBB, 0xBB, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBB, 0xBB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xCC, 0xBB, 0xBB, 0xBB, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x9B, 0xCB, 0xBB, 0xBB, 0xBB, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0xAC, 0xCB, 0xBB, 0xBB, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x89, 0xBC, 0xBB, 0xBB, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x8A, 0xBC, 0xBB, 0xBB, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x9B, 0xCB, 0xBB, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0xBC, 0xBB, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x9B, 0xCB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xCB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xAC, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0xAB, 0xA8, 0x78, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x9B, 0xBE, 0xFF, 0xCA, 0xAB, 0xCE, 0xFD, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0xAB, 0xCC, 0xCA, 0x78, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCF, 0xD9, 0x77, 0x77, 0x79, 0xC8, 0x77, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x9B, 0xCC, 0xBB, 0xCB, 0x87, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xCC, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x9B, 0xCC, 0xBB, 0xBB, 0xCB, 0x87, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x79, 0xB8, 0x77, 0x8A, 0xCB, 0x97, 0x77, 0x8A, 0xA9, 0x88, 0x88, 0x89, 0xAB, 0xCC, 0xBB, 0xBB, 0xBB, 0xBC, 0x97, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x99, 0xAA, 0x99, 0x98, 0x87, 0x77, 0x79, 0x97, 0x78, 0xDF, 0xFF, 0xEA, 0x77, 0x8A, 0xCB, 0xBB, 0xBB, 0xBB, 0xCC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0x97, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x7A, 0xCE, 0xFF, 0xFF, 0xFF, 0xEE, 0xDC, 0xA9, 0x88, 0x87, 0x8C, 0xFF, 0xFF, 0xFE, 0x97, 0x8C, 0xCB, 0xBC, 0xCC, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0x97, 0x88,
-  0x88, 0x88, 0x88, 0x78, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x77, 0x9F, 0xFF, 0xFF, 0xFF, 0xB7, 0x7C, 0xFD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0x97, 0x88,
-  0x88, 0x88, 0x87, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x77, 0x9F, 0xFF, 0xFF, 0xFF, 0xC7, 0x7B, 0xFF, 0xEC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xCD, 0xCC, 0x97, 0x88,
-  0x88, 0x88, 0x87, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x8E, 0xFF, 0xFF, 0xFF, 0xA7, 0x7B, 0xFF, 0xFF, 0xED, 0xDC, 0xCC, 0xCD, 0xDE, 0xFF, 0xFF, 0xFE, 0x97, 0x88,
-  0x88, 0x88, 0x78, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x7B, 0xFF, 0xFF, 0xFD, 0x87, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88,
-  0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x78, 0xBE, 0xFF, 0xC8, 0x77, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88,
-  0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x77, 0x79, 0x99, 0x87, 0x78, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88,
-  0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x87, 0x77, 0x77, 0x77, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x97, 0x88,
-  0x88, 0x88, 0x78, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x97, 0x78, 0x7B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x87, 0x88,
-  0x88, 0x88, 0x78, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCA, 0x98, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x88,
-  0x88, 0x88, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xCC, 0xA8, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x88,
-  0x88, 0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xBB, 0xCA, 0x87, 0x78, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x78, 0x88,
-  0x88, 0x88, 0x87, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0xBC, 0xA8, 0x78, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xBB, 0xBB, 0x87, 0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBB, 0xCA, 0x78, 0x88, 0x87, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x87, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBB, 0xBC, 0xB8, 0x78, 0x88, 0x87, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xBB, 0xBC, 0xA8, 0x78, 0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xBB, 0xBC, 0x97, 0x88, 0x88, 0x88, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x78, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xBB, 0xBC, 0x97, 0x88, 0x88, 0x88, 0x87, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBB, 0xBB, 0xBB, 0x87, 0x88, 0x88, 0x88, 0x87, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xEF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x78, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x77, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xEB, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xDB, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xAE, 0xFF, 0xFF, 0xCB, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x9D, 0xFF, 0xFF, 0xFD, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0xDF, 0xFD, 0xBB, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xAC, 0xCB, 0x98, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8A, 0xCC, 0xBB, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x8A, 0xBC, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x8A, 0xBC, 0xCB, 0xCA, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x8A, 0xBB, 0xB9, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88
+extern const uint8_t fan_slow0_64x64x4[935] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x98, 0xC7, 0xF8,
+  0xF8, 0xF8, 0x27, 0x08, 0x19, 0x0A, 0x3B, 0x1A, 0x19, 0x08, 0x27, 0xF8, 0xF8, 0xA8, 0x17, 0x08,
+  0x0A, 0x0B, 0x0D, 0x0E, 0x8F, 0x0E, 0x0D, 0x0B, 0x09, 0x27, 0xF8, 0xF8, 0x68, 0x17, 0x09, 0x0C,
+  0x0E, 0xFF, 0x0F, 0x0D, 0x09, 0x17, 0xF8, 0xF8, 0x48, 0x07, 0x08, 0x0A, 0x0E, 0xFF, 0x4F, 0x0A,
+  0x17, 0xF8, 0xF8, 0x18, 0x17, 0x08, 0x0B, 0xFF, 0x7F, 0x0A, 0x07, 0xF8, 0xF8, 0x08, 0x07, 0x08,
+  0x09, 0x0B, 0x0C, 0xFF, 0x7F, 0x0E, 0x08, 0x07, 0xF8, 0xE8, 0x07, 0x08, 0x0A, 0x1C, 0x0B, 0x0D,
+  0xFF, 0x7F, 0x0A, 0x07, 0xF8, 0xD8, 0x07, 0x08, 0x0B, 0x0C, 0x3B, 0x0E, 0xFF, 0x6F, 0x0B, 0x07,
+  0xF8, 0xC8, 0x07, 0x08, 0x0B, 0x0C, 0x4B, 0x0C, 0xFF, 0x6F, 0x0B, 0x07, 0xF8, 0xB8, 0x07, 0x08,
+  0x0A, 0x0C, 0x6B, 0x0C, 0xFF, 0x5F, 0x0A, 0x07, 0xF8, 0xB8, 0x07, 0x08, 0x0B, 0x0C, 0x7B, 0x0D,
+  0xFF, 0x3F, 0x0E, 0x09, 0x07, 0xF8, 0xD8, 0x0A, 0x1C, 0x7B, 0x0E, 0xFF, 0x2F, 0x0D, 0x17, 0xF8,
+  0xC8, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x6B, 0x0C, 0xFF, 0x2F, 0x0A, 0x07, 0xF8, 0xE8, 0x17, 0x08,
+  0x0A, 0x1C, 0x5B, 0x0C, 0xFF, 0x0F, 0x0D, 0x08, 0x07, 0xF8, 0xF8, 0x08, 0x07, 0x08, 0x09, 0x0B,
+  0x0C, 0x5B, 0x0E, 0xFF, 0x0A, 0x07, 0xF8, 0xF8, 0x28, 0x17, 0x08, 0x0A, 0x0B, 0x0C, 0x3B, 0x0D,
+  0xEF, 0x0C, 0x17, 0xF8, 0xF8, 0x48, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x2B, 0x0C, 0xDF, 0x0E, 0x08,
+  0x07, 0xF8, 0xF8, 0x68, 0x17, 0x09, 0x0B, 0x0C, 0x2B, 0x0E, 0xCF, 0x0A, 0x07, 0xF8, 0xF8, 0x98,
+  0x07, 0x09, 0x0B, 0x0C, 0x1B, 0x0D, 0xBF, 0x0B, 0x17, 0xC8, 0x27, 0xF8, 0xA8, 0x07, 0x09, 0x0C,
+  0x1B, 0x0D, 0xAF, 0x0C, 0x17, 0xC8, 0x07, 0x28, 0x07, 0xF8, 0x98, 0x07, 0x08, 0x0A, 0x0C, 0x0B,
+  0x0D, 0x9F, 0x0C, 0x08, 0x07, 0xB8, 0x17, 0x08, 0x0A, 0x0B, 0x0A, 0x08, 0x07, 0xF8, 0x98, 0x07,
+  0x09, 0x1B, 0x0E, 0x1F, 0x0C, 0x1A, 0x0B, 0x0C, 0x0E, 0x0F, 0x0D, 0x08, 0x07, 0xA8, 0x17, 0x08,
+  0x0A, 0x0B, 0x2C, 0x0A, 0x07, 0xF8, 0x98, 0x07, 0x08, 0x0B, 0x0C, 0x0F, 0x0D, 0x09, 0x47, 0x09,
+  0x0C, 0x08, 0x17, 0x88, 0x17, 0x08, 0x09, 0x0B, 0x1C, 0x1B, 0x0C, 0x0B, 0x08, 0x07, 0xF8, 0xA8,
+  0x0A, 0x1C, 0x08, 0x87, 0x18, 0x87, 0x08, 0x09, 0x0B, 0x1C, 0x3B, 0x0C, 0x0B, 0x08, 0x07, 0xB8,
+  0xA7, 0x28, 0x07, 0x09, 0x0B, 0x08, 0x17, 0x08, 0x0A, 0x0C, 0x0B, 0x09, 0x27, 0x08, 0x1A, 0x09,
+  0x48, 0x09, 0x0A, 0x0B, 0x1C, 0x6B, 0x0C, 0x09, 0x07, 0x98, 0x27, 0x08, 0x19, 0x1A, 0x29, 0x18,
+  0x37, 0x19, 0x17, 0x08, 0x0D, 0x2F, 0x0E, 0x0A, 0x17, 0x08, 0x0A, 0x0C, 0x6B, 0x1C, 0x8B, 0x0C,
+  0x09, 0x07, 0x88, 0x17, 0x0A, 0x0C, 0x0E, 0x5F, 0x1E, 0x0D, 0x0C, 0x0A, 0x09, 0x28, 0x07, 0x08,
+  0x0C, 0x4F, 0x0E, 0x09, 0x07, 0x08, 0x1C, 0x1B, 0x3C, 0xBB, 0x0C, 0x09, 0x07, 0x78, 0x07, 0x08,
+  0x0C, 0xEF, 0x0E, 0x0B, 0x17, 0x09, 0x6F, 0x0B, 0x17, 0x0C, 0x0F, 0x0D, 0xFB, 0x0B, 0x0C, 0x09,
+  0x07, 0x68, 0x07, 0x08, 0x0D, 0xFF, 0x0F, 0x0D, 0x17, 0x09, 0x6F, 0x0C, 0x17, 0x0B, 0x1F, 0x0E,
+  0x0C, 0xAB, 0x1C, 0x0D, 0x1C, 0x09, 0x07, 0x68, 0x07, 0x0B, 0xFF, 0x1F, 0x0C, 0x17, 0x08, 0x0E,
+  0x5F, 0x0A, 0x17, 0x0B, 0x3F, 0x0E, 0x1D, 0x3C, 0x1D, 0x0E, 0x4F, 0x0E, 0x09, 0x07, 0x58, 0x07,
+  0x08, 0x0D, 0xFF, 0x1F, 0x0E, 0x08, 0x17, 0x0B, 0x4F, 0x0D, 0x08, 0x17, 0x0D, 0xFF, 0x3F, 0x0A,
+  0x07, 0x58, 0x07, 0x09, 0xFF, 0x3F, 0x0A, 0x17, 0x08, 0x0B, 0x0E, 0x1F, 0x0C, 0x08, 0x17, 0x08,
+  0x0E, 0xFF, 0x3F, 0x0A, 0x07, 0x58, 0x07, 0x09, 0xFF, 0x3F, 0x0D, 0x08, 0x27, 0x29, 0x08, 0x17,
+  0x08, 0x0C, 0xFF, 0x4F, 0x0A, 0x07, 0x58, 0x07, 0x09, 0xFF, 0x4F, 0x0D, 0x08, 0x67, 0x08, 0x0C,
+  0xFF, 0x4F, 0x0E, 0x09, 0x07, 0x58, 0x07, 0x08, 0x0E, 0xFF, 0x4F, 0x0E, 0x0B, 0x09, 0x17, 0x08,
+  0x07, 0x0B, 0x0E, 0xFF, 0x5F, 0x0D, 0x08, 0x07, 0x58, 0x07, 0x08, 0x0D, 0xFF, 0x6F, 0x0C, 0x0A,
+  0x09, 0x08, 0x07, 0x0C, 0xFF, 0x6F, 0x0C, 0x07, 0x68, 0x17, 0x0C, 0xFF, 0x4F, 0x0D, 0x2C, 0x0A,
+  0x08, 0x07, 0x0A, 0xFF, 0x6F, 0x0A, 0x07, 0x78, 0x07, 0x0A, 0xFF, 0x2F, 0x0E, 0x0C, 0x1B, 0x0C,
+  0x0A, 0x08, 0x17, 0x08, 0x0E, 0xFF, 0x4F, 0x0E, 0x08, 0x07, 0x78, 0x07, 0x08, 0x0E, 0xFF, 0x0F,
+  0x0E, 0x2B, 0x0C, 0x0A, 0x08, 0x07, 0x08, 0x17, 0x0C, 0xFF, 0x4F, 0x0C, 0x07, 0x98, 0x07, 0x0B,
+  0xFF, 0x0E, 0x4B, 0x08, 0x07, 0x28, 0x07, 0x0A, 0xFF, 0x4F, 0x09, 0x07, 0x98, 0x07, 0x09, 0xFF,
+  0x0C, 0x2B, 0x0C, 0x0A, 0x07, 0x38, 0x07, 0x08, 0x0E, 0xFF, 0x2F, 0x0D, 0x08, 0x07, 0x98, 0x17,
+  0x0C, 0xDF, 0x0D, 0x2B, 0x0C, 0x0B, 0x08, 0x07, 0x38, 0x17, 0x0C, 0xFF, 0x2F, 0x0A, 0x07, 0xB8,
+  0x07, 0x09, 0xCF, 0x0E, 0x3B, 0x0C, 0x0A, 0x08, 0x07, 0x48, 0x07, 0x09, 0xFF, 0x1F, 0x0C, 0x17,
+  0xB8, 0x17, 0x0C, 0xBF, 0x0D, 0x3B, 0x0C, 0x09, 0x07, 0x68, 0x07, 0x0C, 0xFF, 0x0E, 0x08, 0x07,
+  0xD8, 0x07, 0x08, 0x0D, 0xAF, 0x4B, 0x0C, 0x09, 0x07, 0x68, 0x07, 0x09, 0xFF, 0x09, 0x07, 0xF8,
+  0x07, 0x09, 0x0E, 0x8F, 0x0D, 0x5B, 0x08, 0x07, 0x68, 0x17, 0x0C, 0xDF, 0x0B, 0x17, 0xF8, 0x08,
+  0x07, 0x09, 0x0E, 0x7F, 0x0C, 0x3B, 0x0C, 0x0B, 0x08, 0x07, 0x78, 0x07, 0x08, 0x0E, 0xBF, 0x0B,
+  0x17, 0xF8, 0x28, 0x07, 0x0A, 0x6F, 0x0E, 0x4B, 0x0C, 0x0B, 0x08, 0x07, 0x88, 0x07, 0x09, 0xAF,
+  0x0C, 0x17, 0xF8, 0x48, 0x07, 0x0A, 0x5F, 0x0D, 0x4B, 0x0C, 0x0B, 0x08, 0x07, 0x98, 0x07, 0x0A,
+  0x0E, 0x7F, 0x0B, 0x17, 0xF8, 0x58, 0x17, 0x0A, 0x0E, 0x3F, 0x0C, 0x4B, 0x0C, 0x0B, 0x08, 0x07,
+  0xA8, 0x07, 0x09, 0x0D, 0x4F, 0x0D, 0x09, 0x17, 0xF8, 0x78, 0x17, 0x09, 0x0D, 0x1F, 0x0D, 0x5B,
+  0x0C, 0x0B, 0x08, 0x07, 0xB8, 0x07, 0x08, 0x0A, 0x1C, 0x0B, 0x09, 0x08, 0x17, 0xF8, 0xA8, 0x07,
+  0x08, 0x0A, 0x1C, 0x5B, 0x0C, 0x0B, 0x08, 0x07, 0xC8, 0x67, 0xF8, 0xD8, 0x17, 0x08, 0x0A, 0x0B,
+  0x0C, 0x3B, 0x0C, 0x0B, 0x08, 0x07, 0xF8, 0xF8, 0xF8, 0x38, 0x07, 0x18, 0x0A, 0x0B, 0x1C, 0x0B,
+  0x0C, 0x0A, 0x08, 0x07, 0xF8, 0xF8, 0xF8, 0x58, 0x17, 0x08, 0x0A, 0x2B, 0x09, 0x07, 0xF8, 0xF8,
+  0xF8, 0x88, 0x17, 0xF8, 0xF8, 0xF8, 0xF8, 0x27, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x48
 };
 
-extern const uint8_t fan_slow1_64x64x4[2048] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xBB, 0xBA, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8A, 0xCB, 0xCC, 0xBA, 0x88, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBC, 0xBA, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBB, 0xBC, 0xCA, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x9B, 0xCC, 0xA8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBB, 0xBD, 0xFF, 0xD9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x9D, 0xFF, 0xFF, 0xFD, 0x97, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBB, 0xCF, 0xFF, 0xFE, 0xA7, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x78, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBB, 0xDF, 0xFF, 0xFF, 0xFA, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x78, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x88, 0x88, 0x88, 0x87, 0x8B, 0xBB, 0xBB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x97, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x88, 0x88, 0x88, 0x87, 0x9C, 0xBB, 0xBB, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x88, 0x88, 0x88, 0x87, 0x9C, 0xBB, 0xBB, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x78, 0x88, 0x88, 0x78, 0xAC, 0xBB, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x88, 0x88, 0x78, 0xBC, 0xBB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x88, 0x88, 0x7A, 0xCB, 0xBB, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88, 0x87, 0x8B, 0xBB, 0xBB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x78, 0x78, 0xAC, 0xBB, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x88, 0x88,
-  0x88, 0x88, 0x78, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x77, 0x8A, 0xCB, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x88, 0x88,
-  0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0xAC, 0xCC, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x78, 0x88,
-  0x88, 0x88, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x9A, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x78, 0x88,
-  0x88, 0x87, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x78, 0x77, 0x9B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x78, 0x88,
-  0x88, 0x87, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x87, 0x77, 0x77, 0x77, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x78, 0x88,
-  0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x77, 0x89, 0x99, 0x77, 0x78, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x78, 0x88,
-  0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x78, 0xCF, 0xFE, 0xB8, 0x77, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x78, 0x88,
-  0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x77, 0x8D, 0xFF, 0xFF, 0xFB, 0x77, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x78, 0x88,
-  0x88, 0x87, 0x9E, 0xFF, 0xFF, 0xFE, 0xDD, 0xCC, 0xCC, 0xDD, 0xEF, 0xFF, 0xFB, 0x77, 0xAF, 0xFF, 0xFF, 0xFE, 0x87, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x88, 0x88,
-  0x88, 0x87, 0x9C, 0xCD, 0xCC, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xEF, 0xFB, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0x97, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x87, 0x88, 0x88,
-  0x88, 0x87, 0x9C, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xFC, 0x77, 0xBF, 0xFF, 0xFF, 0xFF, 0x97, 0x7B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x78, 0x88, 0x88,
-  0x88, 0x87, 0x9C, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xCC, 0xCC, 0xBB, 0xCC, 0x87, 0x9E, 0xFF, 0xFF, 0xFC, 0x87, 0x88, 0x89, 0xAC, 0xDE, 0xEF, 0xFF, 0xFF, 0xFE, 0xCA, 0x77, 0x88, 0x88, 0x88,
-  0x88, 0x87, 0x9C, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0xCB, 0xBB, 0xBB, 0xBB, 0xCA, 0x87, 0x7A, 0xEF, 0xFF, 0xD8, 0x77, 0x99, 0x77, 0x77, 0x88, 0x99, 0x9A, 0xA9, 0x98, 0x77, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x87, 0x9C, 0xBB, 0xBB, 0xBB, 0xBC, 0xCB, 0xA9, 0x88, 0x88, 0x89, 0xAA, 0x87, 0x77, 0x9B, 0xCA, 0x87, 0x78, 0xB9, 0x78, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x87, 0x8B, 0xCB, 0xBB, 0xBC, 0xCB, 0x98, 0x77, 0x77, 0x77, 0x77, 0x78, 0x87, 0x77, 0x77, 0x77, 0x77, 0x8C, 0xCA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x87, 0x8B, 0xCB, 0xBC, 0xCB, 0x98, 0x77, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0xC9, 0x77, 0x77, 0x79, 0xDF, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x7A, 0xCC, 0xCB, 0xA8, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8D, 0xFE, 0xCB, 0xAA, 0xCF, 0xFE, 0xBB, 0x97, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x78, 0xAB, 0xA8, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBC, 0xA8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBB, 0xC9, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBB, 0xCB, 0x97, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0xBC, 0xB9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBB, 0xCB, 0x98, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xBB, 0xBC, 0xBA, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xBB, 0xBB, 0xBC, 0xB9, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBB, 0xBB, 0xBB, 0xCC, 0xA8, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBB, 0xBB, 0xBB, 0xCB, 0x98, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xBB, 0xBB, 0xBB, 0xBC, 0xCA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBB, 0xBB, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBB, 0xBB, 0xBB, 0xCA, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBB, 0xBB, 0xBC, 0xB8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBB, 0xBB, 0xCB, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xCC, 0xA8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB9, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x9B, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xDB, 0xA8, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x89, 0x9A, 0xAB, 0xBB, 0xBA, 0x99, 0x87, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88
+extern const uint8_t fan_slow1_64x64x4[935] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0x58, 0x27, 0xF8, 0xF8, 0xF8, 0xF8, 0x17, 0xF8, 0xF8, 0xF8, 0x88, 0x07, 0x09, 0x2B,
+  0x0A, 0x08, 0x17, 0xF8, 0xF8, 0xF8, 0x58, 0x07, 0x08, 0x0A, 0x0C, 0x0B, 0x1C, 0x0B, 0x0A, 0x18,
+  0x07, 0xF8, 0xF8, 0xF8, 0x38, 0x07, 0x08, 0x0B, 0x0C, 0x3B, 0x0C, 0x0B, 0x0A, 0x08, 0x17, 0xF8,
+  0xD8, 0x67, 0xC8, 0x07, 0x08, 0x0B, 0x0C, 0x5B, 0x1C, 0x0A, 0x08, 0x07, 0xF8, 0xA8, 0x17, 0x08,
+  0x09, 0x0B, 0x1C, 0x0A, 0x08, 0x07, 0xB8, 0x07, 0x08, 0x0B, 0x0C, 0x5B, 0x0D, 0x1F, 0x0D, 0x09,
+  0x17, 0xF8, 0x78, 0x17, 0x09, 0x0D, 0x4F, 0x0D, 0x09, 0x07, 0xA8, 0x07, 0x08, 0x0B, 0x0C, 0x4B,
+  0x0C, 0x3F, 0x0E, 0x0A, 0x17, 0xF8, 0x58, 0x17, 0x0B, 0x7F, 0x0E, 0x0A, 0x07, 0x98, 0x07, 0x08,
+  0x0B, 0x0C, 0x4B, 0x0D, 0x5F, 0x0A, 0x07, 0xF8, 0x48, 0x17, 0x0C, 0xAF, 0x09, 0x07, 0x88, 0x07,
+  0x08, 0x0B, 0x0C, 0x4B, 0x0E, 0x6F, 0x0A, 0x07, 0xF8, 0x28, 0x17, 0x0B, 0xBF, 0x0E, 0x08, 0x07,
+  0x78, 0x07, 0x08, 0x0B, 0x0C, 0x3B, 0x0C, 0x7F, 0x0E, 0x09, 0x07, 0xF8, 0x08, 0x17, 0x0B, 0xDF,
+  0x0C, 0x17, 0x68, 0x07, 0x08, 0x5B, 0x0D, 0x8F, 0x0E, 0x09, 0x07, 0xF8, 0x07, 0x09, 0xFF, 0x09,
+  0x07, 0x68, 0x07, 0x09, 0x0C, 0x4B, 0xAF, 0x0D, 0x08, 0x07, 0xD8, 0x07, 0x08, 0x0E, 0xFF, 0x0C,
+  0x07, 0x68, 0x07, 0x09, 0x0C, 0x3B, 0x0D, 0xBF, 0x0C, 0x17, 0xB8, 0x17, 0x0C, 0xFF, 0x1F, 0x09,
+  0x07, 0x48, 0x07, 0x08, 0x0A, 0x0C, 0x3B, 0x0E, 0xCF, 0x09, 0x07, 0xB8, 0x07, 0x0A, 0xFF, 0x2F,
+  0x0C, 0x17, 0x38, 0x07, 0x08, 0x0B, 0x0C, 0x2B, 0x0D, 0xDF, 0x0C, 0x17, 0x98, 0x07, 0x08, 0x0D,
+  0xFF, 0x2F, 0x0E, 0x08, 0x07, 0x38, 0x07, 0x0A, 0x0C, 0x2B, 0x0C, 0xFF, 0x09, 0x07, 0x98, 0x07,
+  0x09, 0xFF, 0x4F, 0x0A, 0x07, 0x28, 0x07, 0x08, 0x4B, 0x0E, 0xFF, 0x0B, 0x07, 0x98, 0x07, 0x0C,
+  0xFF, 0x4F, 0x0C, 0x17, 0x08, 0x07, 0x08, 0x0A, 0x0C, 0x2B, 0x0E, 0xFF, 0x0F, 0x0E, 0x08, 0x07,
+  0x78, 0x07, 0x08, 0x0E, 0xFF, 0x4F, 0x0E, 0x08, 0x17, 0x08, 0x0A, 0x0C, 0x1B, 0x0C, 0x0E, 0xFF,
+  0x2F, 0x0A, 0x07, 0x78, 0x07, 0x0A, 0xFF, 0x6F, 0x0A, 0x07, 0x08, 0x0A, 0x2C, 0x0D, 0xFF, 0x4F,
+  0x0C, 0x17, 0x68, 0x07, 0x0C, 0xFF, 0x6F, 0x0C, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0xFF, 0x6F, 0x0D,
+  0x08, 0x07, 0x58, 0x07, 0x08, 0x0D, 0xFF, 0x5F, 0x0E, 0x0B, 0x07, 0x08, 0x17, 0x09, 0x0B, 0x0E,
+  0xFF, 0x4F, 0x0E, 0x08, 0x07, 0x58, 0x07, 0x09, 0x0E, 0xFF, 0x4F, 0x0C, 0x08, 0x67, 0x08, 0x0D,
+  0xFF, 0x4F, 0x09, 0x07, 0x58, 0x07, 0x0A, 0xFF, 0x4F, 0x0C, 0x08, 0x17, 0x08, 0x29, 0x27, 0x08,
+  0x0D, 0xFF, 0x3F, 0x09, 0x07, 0x58, 0x07, 0x0A, 0xFF, 0x3F, 0x0E, 0x08, 0x17, 0x08, 0x0C, 0x1F,
+  0x0E, 0x0B, 0x08, 0x17, 0x0A, 0xFF, 0x3F, 0x09, 0x07, 0x58, 0x07, 0x0A, 0xFF, 0x3F, 0x0D, 0x17,
+  0x08, 0x0D, 0x4F, 0x0B, 0x17, 0x08, 0x0E, 0xFF, 0x1F, 0x0D, 0x08, 0x07, 0x58, 0x07, 0x09, 0x0E,
+  0x4F, 0x0E, 0x1D, 0x3C, 0x1D, 0x0E, 0x3F, 0x0B, 0x17, 0x0A, 0x5F, 0x0E, 0x08, 0x17, 0x0C, 0xFF,
+  0x1F, 0x0B, 0x07, 0x68, 0x07, 0x09, 0x1C, 0x0D, 0x1C, 0xAB, 0x0C, 0x0E, 0x1F, 0x0B, 0x17, 0x0C,
+  0x6F, 0x09, 0x17, 0x0D, 0xFF, 0x0F, 0x0D, 0x08, 0x07, 0x68, 0x07, 0x09, 0x0C, 0xFB, 0x0B, 0x0D,
+  0x0F, 0x0C, 0x17, 0x0B, 0x6F, 0x09, 0x17, 0x0B, 0x0E, 0xEF, 0x0C, 0x08, 0x07, 0x78, 0x07, 0x09,
+  0x0C, 0xBB, 0x3C, 0x1B, 0x1C, 0x08, 0x07, 0x09, 0x0E, 0x4F, 0x0C, 0x08, 0x07, 0x28, 0x09, 0x0A,
+  0x0C, 0x0D, 0x1E, 0x5F, 0x0E, 0x0C, 0x0A, 0x17, 0x88, 0x07, 0x09, 0x0C, 0x8B, 0x1C, 0x6B, 0x0C,
+  0x0A, 0x08, 0x17, 0x0A, 0x0E, 0x2F, 0x0D, 0x08, 0x17, 0x19, 0x37, 0x18, 0x29, 0x1A, 0x19, 0x08,
+  0x27, 0x98, 0x07, 0x09, 0x0C, 0x6B, 0x1C, 0x0B, 0x0A, 0x09, 0x48, 0x09, 0x1A, 0x08, 0x27, 0x09,
+  0x0B, 0x0C, 0x0A, 0x08, 0x17, 0x08, 0x0B, 0x09, 0x07, 0x28, 0xA7, 0xB8, 0x07, 0x08, 0x0B, 0x0C,
+  0x3B, 0x1C, 0x0B, 0x09, 0x08, 0x87, 0x18, 0x87, 0x08, 0x1C, 0x0A, 0xF8, 0xA8, 0x07, 0x08, 0x0B,
+  0x0C, 0x1B, 0x1C, 0x0B, 0x09, 0x08, 0x17, 0x88, 0x17, 0x08, 0x0C, 0x09, 0x47, 0x09, 0x0D, 0x0F,
+  0x0C, 0x0B, 0x08, 0x07, 0xF8, 0x98, 0x07, 0x0A, 0x2C, 0x0B, 0x0A, 0x08, 0x17, 0xA8, 0x07, 0x08,
+  0x0D, 0x0F, 0x0E, 0x0C, 0x0B, 0x1A, 0x0C, 0x1F, 0x0E, 0x1B, 0x09, 0x07, 0xF8, 0x98, 0x07, 0x08,
+  0x0A, 0x0B, 0x0A, 0x08, 0x17, 0xB8, 0x07, 0x08, 0x0C, 0x9F, 0x0D, 0x0B, 0x0C, 0x0A, 0x08, 0x07,
+  0xF8, 0x98, 0x07, 0x28, 0x07, 0xC8, 0x17, 0x0C, 0xAF, 0x0D, 0x1B, 0x0C, 0x09, 0x07, 0xF8, 0xA8,
+  0x27, 0xC8, 0x17, 0x0B, 0xBF, 0x0D, 0x1B, 0x0C, 0x0B, 0x09, 0x07, 0xF8, 0xF8, 0x98, 0x07, 0x0A,
+  0xCF, 0x0E, 0x2B, 0x0C, 0x0B, 0x09, 0x17, 0xF8, 0xF8, 0x68, 0x07, 0x08, 0x0E, 0xDF, 0x0C, 0x2B,
+  0x0C, 0x0B, 0x09, 0x08, 0x07, 0xF8, 0xF8, 0x48, 0x17, 0x0C, 0xEF, 0x0D, 0x3B, 0x0C, 0x0B, 0x0A,
+  0x08, 0x17, 0xF8, 0xF8, 0x28, 0x07, 0x0A, 0xFF, 0x0E, 0x5B, 0x0C, 0x0B, 0x09, 0x08, 0x07, 0xF8,
+  0xF8, 0x08, 0x07, 0x08, 0x0D, 0xFF, 0x0F, 0x0C, 0x5B, 0x1C, 0x0A, 0x08, 0x17, 0xF8, 0xE8, 0x07,
+  0x0A, 0xFF, 0x2F, 0x0C, 0x6B, 0x0C, 0x0B, 0x09, 0x08, 0x07, 0xF8, 0xC8, 0x17, 0x0D, 0xFF, 0x2F,
+  0x0E, 0x7B, 0x1C, 0x0A, 0xF8, 0xD8, 0x07, 0x09, 0x0E, 0xFF, 0x3F, 0x0D, 0x7B, 0x0C, 0x0B, 0x08,
+  0x07, 0xF8, 0xB8, 0x07, 0x0A, 0xFF, 0x5F, 0x0C, 0x6B, 0x0C, 0x0A, 0x08, 0x07, 0xF8, 0xB8, 0x07,
+  0x0B, 0xFF, 0x6F, 0x0C, 0x4B, 0x0C, 0x0B, 0x08, 0x07, 0xF8, 0xC8, 0x07, 0x0B, 0xFF, 0x6F, 0x0E,
+  0x3B, 0x0C, 0x0B, 0x08, 0x07, 0xF8, 0xD8, 0x07, 0x0A, 0xFF, 0x7F, 0x0D, 0x0B, 0x1C, 0x0A, 0x08,
+  0x07, 0xF8, 0xE8, 0x07, 0x08, 0x0E, 0xFF, 0x7F, 0x0C, 0x0B, 0x09, 0x08, 0x07, 0xF8, 0xF8, 0x08,
+  0x07, 0x0A, 0xFF, 0x7F, 0x0B, 0x08, 0x17, 0xF8, 0xF8, 0x18, 0x17, 0x0A, 0xFF, 0x4F, 0x0E, 0x0A,
+  0x08, 0x07, 0xF8, 0xF8, 0x48, 0x17, 0x09, 0x0D, 0xFF, 0x0F, 0x0E, 0x0C, 0x09, 0x17, 0xF8, 0xF8,
+  0x68, 0x27, 0x09, 0x0B, 0x0D, 0x0E, 0x8F, 0x0E, 0x0D, 0x0B, 0x0A, 0x08, 0x17, 0xF8, 0xF8, 0xA8,
+  0x27, 0x08, 0x19, 0x1A, 0x3B, 0x0A, 0x19, 0x08, 0x27, 0xF8, 0xF8, 0xF8, 0xC7, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x88
 };
 
 #endif // HAS_GRAPHICAL_TFT
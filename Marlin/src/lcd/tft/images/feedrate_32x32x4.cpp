@@ -24,39 +24,39 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t feedrate_32x32x4[512] = {
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x78, 0x77, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x77, 0x8A, 0xCD, 0xA8, 0xCC, 0xB9, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x77, 0x9C, 0xEF, 0xFF, 0xA8, 0xFF, 0xFF, 0xDA, 0x87, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x8B, 0xEF, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0xFF, 0xD9, 0x77, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x78, 0xCF, 0xFF, 0xFF, 0xEC, 0x76, 0xBD, 0xEF, 0xFF, 0xFF, 0x97, 0x78, 0x88, 0x88,
-  0x88, 0x87, 0x8D, 0xFF, 0xFF, 0xC9, 0x65, 0x55, 0x65, 0x6A, 0xEF, 0xFB, 0x67, 0x87, 0x88, 0x88,
-  0x88, 0x77, 0xCF, 0xFF, 0xE9, 0x55, 0x55, 0x55, 0x65, 0x55, 0x6B, 0xB5, 0x7D, 0xB7, 0x78, 0x88,
-  0x87, 0x7A, 0xFF, 0xFE, 0x85, 0x55, 0x56, 0x67, 0x77, 0x66, 0x55, 0x57, 0xDF, 0xF8, 0x78, 0x88,
-  0x87, 0x8E, 0xFF, 0xF8, 0x55, 0x56, 0x67, 0x88, 0x88, 0x87, 0x76, 0x58, 0xFF, 0xFC, 0x67, 0x88,
-  0x77, 0xBF, 0xFF, 0xA5, 0x55, 0x67, 0x88, 0x88, 0x87, 0x78, 0xB9, 0x66, 0xBF, 0xFF, 0x86, 0x88,
-  0x78, 0xDF, 0xFD, 0x65, 0x56, 0x78, 0x88, 0x87, 0x77, 0xAE, 0xD8, 0x77, 0x7E, 0xFF, 0xB5, 0x78,
-  0x79, 0xFF, 0xFA, 0x55, 0x67, 0x88, 0x88, 0x77, 0x9C, 0xFF, 0x86, 0x56, 0x7B, 0xFF, 0xE6, 0x68,
-  0x7A, 0xFF, 0xF7, 0x55, 0x78, 0x88, 0x87, 0x8B, 0xFF, 0xFB, 0x55, 0x67, 0x79, 0xFF, 0xF8, 0x68,
-  0x7B, 0xFF, 0xE6, 0x56, 0x78, 0x88, 0x78, 0xDF, 0xFF, 0xE7, 0x55, 0x78, 0x79, 0xEE, 0xE8, 0x57,
-  0x7C, 0xFF, 0xD6, 0x57, 0x88, 0x87, 0x7C, 0xFF, 0xFF, 0xA5, 0x56, 0x78, 0x78, 0x77, 0x76, 0x57,
-  0x7C, 0xFF, 0xD6, 0x57, 0x88, 0x87, 0x7C, 0xFF, 0xFD, 0x65, 0x57, 0x88, 0x78, 0x98, 0x86, 0x57,
-  0x7B, 0xFF, 0xD6, 0x57, 0x88, 0x88, 0x79, 0xEF, 0xE8, 0x55, 0x67, 0x88, 0x79, 0xFF, 0xF9, 0x67,
-  0x7B, 0xFF, 0xF7, 0x57, 0x88, 0x88, 0x87, 0x78, 0x75, 0x55, 0x78, 0x88, 0x7A, 0xFF, 0xF8, 0x67,
-  0x79, 0xFF, 0xF9, 0x57, 0x88, 0x88, 0x88, 0x65, 0x55, 0x56, 0x88, 0x87, 0x7C, 0xFF, 0xD6, 0x56,
-  0x78, 0xEF, 0xFD, 0x57, 0x88, 0x88, 0x88, 0x76, 0x55, 0x67, 0x88, 0x87, 0x8F, 0xFF, 0xB5, 0x57,
-  0x77, 0xBF, 0xFF, 0x96, 0x88, 0x88, 0x88, 0x88, 0x77, 0x78, 0x88, 0x77, 0xCF, 0xFF, 0x85, 0x67,
-  0x87, 0x8E, 0xFF, 0xE8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7A, 0xFF, 0xFC, 0x55, 0x67,
-  0x88, 0x7A, 0xFF, 0xFD, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x77, 0x9E, 0xFF, 0xF7, 0x55, 0x68,
-  0x88, 0x77, 0xBF, 0xFF, 0xEA, 0x77, 0x77, 0x88, 0x87, 0x77, 0x7A, 0xFF, 0xFF, 0x95, 0x56, 0x78,
-  0x88, 0x87, 0x6C, 0xFF, 0xFF, 0xC9, 0x87, 0x77, 0x77, 0x89, 0xDF, 0xFF, 0xFB, 0x55, 0x56, 0x88,
-  0x88, 0x88, 0x76, 0xCF, 0xFF, 0xFF, 0xDC, 0xBB, 0xBC, 0xEF, 0xFF, 0xFF, 0xA5, 0x55, 0x67, 0x88,
-  0x88, 0x88, 0x86, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x55, 0x55, 0x78, 0x88,
-  0x88, 0x88, 0x87, 0x65, 0x7B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x55, 0x57, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x86, 0x55, 0x79, 0xBD, 0xDE, 0xDC, 0xB9, 0x65, 0x55, 0x56, 0x78, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x76, 0x55, 0x56, 0x66, 0x66, 0x55, 0x55, 0x55, 0x67, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x87, 0x76, 0x55, 0x55, 0x55, 0x55, 0x56, 0x67, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x66, 0x66, 0x66, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88
+extern const uint8_t feedrate_32x32x4[504] = {
+  0x88, 0x57, 0x08, 0x57, 0xF8, 0x08, 0x27, 0x08, 0x0A, 0x0C, 0x0D, 0x0A, 0x08, 0x1C, 0x0B, 0x09,
+  0x08, 0x17, 0xE8, 0x17, 0x09, 0x0C, 0x0E, 0x2F, 0x0A, 0x08, 0x3F, 0x0D, 0x0A, 0x08, 0x07, 0xC8,
+  0x07, 0x08, 0x0B, 0x0E, 0x4F, 0x09, 0x07, 0x5F, 0x0D, 0x09, 0x17, 0x98, 0x07, 0x08, 0x0C, 0x4F,
+  0x0E, 0x0C, 0x07, 0x06, 0x0B, 0x0D, 0x0E, 0x4F, 0x09, 0x17, 0x78, 0x07, 0x08, 0x0D, 0x3F, 0x0C,
+  0x09, 0x06, 0x25, 0x06, 0x05, 0x06, 0x0A, 0x0E, 0x1F, 0x0B, 0x06, 0x07, 0x08, 0x07, 0x58, 0x17,
+  0x0C, 0x2F, 0x0E, 0x09, 0x55, 0x06, 0x25, 0x06, 0x1B, 0x05, 0x07, 0x0D, 0x0B, 0x17, 0x38, 0x17,
+  0x0A, 0x2F, 0x0E, 0x08, 0x35, 0x16, 0x27, 0x16, 0x25, 0x07, 0x0D, 0x1F, 0x08, 0x07, 0x38, 0x07,
+  0x08, 0x0E, 0x2F, 0x08, 0x25, 0x16, 0x07, 0x48, 0x17, 0x06, 0x05, 0x08, 0x2F, 0x0C, 0x06, 0x07,
+  0x18, 0x17, 0x0B, 0x2F, 0x0A, 0x25, 0x06, 0x07, 0x48, 0x17, 0x08, 0x0B, 0x09, 0x16, 0x0B, 0x2F,
+  0x08, 0x06, 0x18, 0x07, 0x08, 0x0D, 0x1F, 0x0D, 0x06, 0x15, 0x06, 0x07, 0x38, 0x27, 0x0A, 0x0E,
+  0x0D, 0x08, 0x27, 0x0E, 0x1F, 0x0B, 0x05, 0x07, 0x08, 0x07, 0x09, 0x2F, 0x0A, 0x15, 0x06, 0x07,
+  0x38, 0x17, 0x09, 0x0C, 0x1F, 0x08, 0x06, 0x05, 0x06, 0x07, 0x0B, 0x1F, 0x0E, 0x16, 0x08, 0x07,
+  0x0A, 0x2F, 0x07, 0x15, 0x07, 0x38, 0x07, 0x08, 0x0B, 0x2F, 0x0B, 0x15, 0x06, 0x17, 0x09, 0x2F,
+  0x08, 0x06, 0x08, 0x07, 0x0B, 0x1F, 0x0E, 0x06, 0x05, 0x06, 0x07, 0x28, 0x07, 0x08, 0x0D, 0x2F,
+  0x0E, 0x07, 0x15, 0x07, 0x08, 0x07, 0x09, 0x2E, 0x08, 0x05, 0x17, 0x0C, 0x1F, 0x0D, 0x06, 0x05,
+  0x07, 0x28, 0x17, 0x0C, 0x3F, 0x0A, 0x15, 0x06, 0x07, 0x08, 0x07, 0x08, 0x27, 0x06, 0x05, 0x17,
+  0x0C, 0x1F, 0x0D, 0x06, 0x05, 0x07, 0x28, 0x17, 0x0C, 0x2F, 0x0D, 0x06, 0x15, 0x07, 0x18, 0x07,
+  0x08, 0x09, 0x18, 0x06, 0x05, 0x17, 0x0B, 0x1F, 0x0D, 0x06, 0x05, 0x07, 0x38, 0x07, 0x09, 0x0E,
+  0x0F, 0x0E, 0x08, 0x15, 0x06, 0x07, 0x18, 0x07, 0x09, 0x2F, 0x09, 0x06, 0x17, 0x0B, 0x2F, 0x07,
+  0x05, 0x07, 0x48, 0x17, 0x08, 0x07, 0x25, 0x07, 0x28, 0x07, 0x0A, 0x2F, 0x08, 0x06, 0x17, 0x09,
+  0x2F, 0x09, 0x05, 0x07, 0x58, 0x06, 0x35, 0x06, 0x28, 0x17, 0x0C, 0x1F, 0x0D, 0x06, 0x05, 0x06,
+  0x07, 0x08, 0x0E, 0x1F, 0x0D, 0x05, 0x07, 0x58, 0x07, 0x06, 0x15, 0x06, 0x07, 0x28, 0x07, 0x08,
+  0x2F, 0x0B, 0x15, 0x27, 0x0B, 0x2F, 0x09, 0x06, 0x78, 0x27, 0x28, 0x17, 0x0C, 0x2F, 0x08, 0x05,
+  0x06, 0x07, 0x08, 0x07, 0x08, 0x0E, 0x1F, 0x0E, 0x08, 0x07, 0xB8, 0x17, 0x0A, 0x2F, 0x0C, 0x15,
+  0x06, 0x07, 0x18, 0x07, 0x0A, 0x2F, 0x0D, 0x08, 0x17, 0x88, 0x17, 0x09, 0x0E, 0x2F, 0x07, 0x15,
+  0x06, 0x28, 0x17, 0x0B, 0x2F, 0x0E, 0x0A, 0x37, 0x28, 0x37, 0x0A, 0x3F, 0x09, 0x15, 0x06, 0x07,
+  0x38, 0x07, 0x06, 0x0C, 0x3F, 0x0C, 0x09, 0x08, 0x47, 0x08, 0x09, 0x0D, 0x3F, 0x0B, 0x25, 0x06,
+  0x58, 0x07, 0x06, 0x0C, 0x4F, 0x0D, 0x0C, 0x2B, 0x0C, 0x0E, 0x4F, 0x0A, 0x25, 0x06, 0x07, 0x68,
+  0x16, 0x0A, 0xDF, 0x0E, 0x08, 0x35, 0x07, 0x78, 0x07, 0x06, 0x05, 0x07, 0x0B, 0x0E, 0x8F, 0x0D,
+  0x0A, 0x06, 0x35, 0x07, 0xA8, 0x06, 0x15, 0x07, 0x09, 0x0B, 0x1D, 0x0E, 0x0D, 0x0C, 0x0B, 0x09,
+  0x06, 0x35, 0x06, 0x07, 0xC8, 0x07, 0x06, 0x25, 0x46, 0x55, 0x06, 0x07, 0xE8, 0x17, 0x06, 0x85,
+  0x16, 0x07, 0xF8, 0x28, 0x27, 0x56, 0x17, 0x98
 };
 
 #endif // HAS_GRAPHICAL_TFT
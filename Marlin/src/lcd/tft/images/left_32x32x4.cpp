@@ -24,39 +24,21 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t left_32x32x4[512] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xAF, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7A, 0xFF, 0xF7, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xAF, 0xFF, 0xFF, 0x87, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7A, 0xFF, 0xFF, 0xFB, 0x46, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xAF, 0xFF, 0xFF, 0xA3, 0x34, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x7A, 0xFF, 0xFF, 0xFB, 0x34, 0x47, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0xAF, 0xFF, 0xFF, 0xB3, 0x44, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFB, 0x34, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0x9F, 0xFF, 0xFF, 0xA3, 0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x79, 0xFF, 0xFF, 0xFA, 0x34, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x77, 0xAF, 0xFF, 0xFF, 0xA3, 0x34, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x7A, 0xFF, 0xFF, 0xFA, 0x33, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x8D, 0xFF, 0xFF, 0xF6, 0x34, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x87, 0x76, 0xBF, 0xFF, 0xFF, 0x67, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x3B, 0xFF, 0xFF, 0xF8, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x73, 0xCF, 0xFF, 0xFF, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x3C, 0xFF, 0xFF, 0xF8, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0xCF, 0xFF, 0xFF, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x3B, 0xFF, 0xFF, 0xF7, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x74, 0xBF, 0xFF, 0xFF, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x4B, 0xFF, 0xFF, 0xF8, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x74, 0xBF, 0xFF, 0xFF, 0x87, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x4B, 0xFF, 0xF9, 0x46, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x74, 0xCF, 0x93, 0x34, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x4B, 0x34, 0x47, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x73, 0x34, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88
+extern const uint8_t left_32x32x4[221] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x08, 0x47, 0xF8, 0x98, 0x17, 0x0A, 0x0F, 0x08, 0x17, 0xF8, 0x78,
+  0x17, 0x0A, 0x2F, 0x17, 0xF8, 0x68, 0x17, 0x0A, 0x4F, 0x08, 0x07, 0xF8, 0x48, 0x17, 0x0A, 0x4F,
+  0x0B, 0x04, 0x06, 0xF8, 0x38, 0x17, 0x0A, 0x4F, 0x0A, 0x13, 0x04, 0xF8, 0x28, 0x17, 0x0A, 0x4F,
+  0x0B, 0x03, 0x14, 0x07, 0xF8, 0x18, 0x17, 0x0A, 0x4F, 0x0B, 0x03, 0x14, 0x07, 0xF8, 0x28, 0x07,
+  0x09, 0x4F, 0x0B, 0x03, 0x14, 0xF8, 0x28, 0x17, 0x09, 0x4F, 0x0A, 0x03, 0x14, 0xF8, 0x28, 0x17,
+  0x09, 0x4F, 0x0A, 0x03, 0x14, 0xF8, 0x28, 0x17, 0x0A, 0x4F, 0x0A, 0x13, 0x04, 0x07, 0xF8, 0x18,
+  0x17, 0x0A, 0x4F, 0x0A, 0x13, 0x04, 0x07, 0xF8, 0x28, 0x07, 0x08, 0x0D, 0x4F, 0x06, 0x03, 0x04,
+  0x07, 0xF8, 0x38, 0x17, 0x06, 0x0B, 0x4F, 0x06, 0x07, 0xF8, 0x68, 0x07, 0x03, 0x0B, 0x4F, 0x08,
+  0x17, 0xF8, 0x58, 0x07, 0x03, 0x0C, 0x4F, 0x08, 0x07, 0xF8, 0x78, 0x03, 0x0C, 0x4F, 0x08, 0x07,
+  0xF8, 0x78, 0x03, 0x0C, 0x4F, 0x17, 0xF8, 0x78, 0x03, 0x0B, 0x4F, 0x17, 0xF8, 0x68, 0x07, 0x04,
+  0x0B, 0x4F, 0x08, 0x17, 0xF8, 0x58, 0x07, 0x04, 0x0B, 0x4F, 0x08, 0x07, 0xF8, 0x68, 0x07, 0x04,
+  0x0B, 0x4F, 0x08, 0x07, 0xF8, 0x68, 0x07, 0x04, 0x0B, 0x2F, 0x09, 0x04, 0x06, 0xF8, 0x78, 0x07,
+  0x04, 0x0C, 0x0F, 0x09, 0x13, 0x04, 0xF8, 0x88, 0x07, 0x04, 0x0B, 0x03, 0x14, 0x07, 0xF8, 0x98,
+  0x07, 0x13, 0x04, 0xF8, 0xC8, 0x07, 0x04, 0x07, 0xF8, 0xF8, 0xF8, 0xF8, 0x98
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -24,39 +24,24 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t refresh_32x32x4[512] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x9F, 0x67, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xFF, 0x57, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xFF, 0x9A, 0x87, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0xFF, 0xFF, 0xFF, 0xFE, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xFF, 0xCE, 0xFF, 0xFD, 0x77, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0x88, 0x6A, 0xFF, 0x55, 0x5C, 0xFF, 0xD7, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0xA7, 0x78, 0x86, 0x9F, 0x57, 0x75, 0x8F, 0xFB, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x78, 0xFC, 0x78, 0x88, 0x69, 0x67, 0x88, 0x69, 0xFF, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7C, 0xFF, 0x58, 0x88, 0x87, 0x58, 0x88, 0x86, 0xFF, 0xA7, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7E, 0xFA, 0x58, 0x88, 0x88, 0x88, 0x88, 0x87, 0xBF, 0xE5, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7F, 0xF8, 0x68, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xF5, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7F, 0xF8, 0x68, 0x88, 0x88, 0x88, 0x88, 0x87, 0xAF, 0xF5, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7E, 0xFA, 0x68, 0x88, 0x88, 0x88, 0x88, 0x87, 0xCF, 0xE5, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x7C, 0xFF, 0x68, 0x88, 0x87, 0x78, 0x88, 0x77, 0xFF, 0xA5, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x78, 0xFF, 0xA7, 0x88, 0x78, 0xB7, 0x88, 0x77, 0xBF, 0x66, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0xBF, 0xF9, 0x77, 0x77, 0xFB, 0x78, 0x88, 0x68, 0x57, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x6D, 0xFF, 0xD8, 0x77, 0xFF, 0xB7, 0x78, 0x87, 0x68, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x85, 0xCF, 0xFF, 0xFD, 0xFF, 0xFB, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x57, 0xEF, 0xFF, 0xFF, 0xFF, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x55, 0x89, 0xFF, 0xF8, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x65, 0xFF, 0x75, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF7, 0x57, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x75, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x67, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88
+extern const uint8_t refresh_32x32x4[268] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xE8, 0x17, 0xF8, 0xC8, 0x07, 0x09, 0x08, 0x07, 0xF8, 0xA8,
+  0x07, 0x09, 0x0F, 0x06, 0x07, 0xF8, 0x98, 0x07, 0x09, 0x1F, 0x05, 0x17, 0xF8, 0x78, 0x07, 0x0A,
+  0x2F, 0x09, 0x0A, 0x08, 0x17, 0xF8, 0x48, 0x07, 0x09, 0x6F, 0x0E, 0x09, 0x17, 0xF8, 0x38, 0x07,
+  0x0A, 0x2F, 0x0C, 0x0E, 0x2F, 0x0D, 0x17, 0xF8, 0x17, 0x18, 0x06, 0x0A, 0x1F, 0x25, 0x0C, 0x1F,
+  0x0D, 0x07, 0xE8, 0x07, 0x0A, 0x17, 0x18, 0x06, 0x09, 0x0F, 0x05, 0x17, 0x05, 0x08, 0x1F, 0x0B,
+  0x07, 0xC8, 0x07, 0x08, 0x0F, 0x0C, 0x07, 0x28, 0x06, 0x09, 0x06, 0x07, 0x18, 0x06, 0x09, 0x1F,
+  0x07, 0xC8, 0x07, 0x0C, 0x1F, 0x05, 0x38, 0x07, 0x05, 0x38, 0x06, 0x1F, 0x0A, 0x07, 0xB8, 0x07,
+  0x0E, 0x0F, 0x0A, 0x05, 0x98, 0x07, 0x0B, 0x0F, 0x0E, 0x05, 0xB8, 0x07, 0x1F, 0x08, 0x06, 0x98,
+  0x07, 0x0A, 0x1F, 0x05, 0xB8, 0x07, 0x1F, 0x08, 0x06, 0x98, 0x07, 0x0A, 0x1F, 0x05, 0xB8, 0x07,
+  0x0E, 0x0F, 0x0A, 0x06, 0x98, 0x07, 0x0C, 0x0F, 0x0E, 0x05, 0xB8, 0x07, 0x0C, 0x1F, 0x06, 0x38,
+  0x17, 0x28, 0x17, 0x1F, 0x0A, 0x05, 0xB8, 0x07, 0x08, 0x1F, 0x0A, 0x07, 0x18, 0x07, 0x08, 0x0B,
+  0x07, 0x18, 0x17, 0x0B, 0x0F, 0x16, 0xC8, 0x07, 0x0B, 0x1F, 0x09, 0x37, 0x0F, 0x0B, 0x07, 0x28,
+  0x06, 0x08, 0x05, 0x07, 0xD8, 0x06, 0x0D, 0x1F, 0x0D, 0x08, 0x17, 0x1F, 0x0B, 0x17, 0x18, 0x07,
+  0x06, 0xF8, 0x05, 0x0C, 0x3F, 0x0D, 0x2F, 0x0B, 0x07, 0xF8, 0x48, 0x05, 0x07, 0x0E, 0x6F, 0x08,
+  0x07, 0xF8, 0x48, 0x07, 0x15, 0x08, 0x09, 0x2F, 0x08, 0x04, 0x07, 0xF8, 0x68, 0x07, 0x06, 0x05,
+  0x1F, 0x07, 0x05, 0x07, 0xF8, 0xA8, 0x0F, 0x07, 0x05, 0x07, 0xF8, 0x98, 0x07, 0x08, 0x07, 0x05,
+  0x07, 0xF8, 0xC8, 0x06, 0x07, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xD8
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -24,39 +24,22 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t right_32x32x4[512] = {
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0x8F, 0xA7, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x78, 0xFF, 0xF9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x8F, 0xFF, 0xFF, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x7B, 0xFF, 0xFF, 0xF9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x84, 0xAF, 0xFF, 0xFF, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x3A, 0xFF, 0xFF, 0xF9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0xAF, 0xFF, 0xFF, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x3A, 0xFF, 0xFF, 0xF9, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0xAF, 0xFF, 0xFF, 0x97, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x4A, 0xFF, 0xFF, 0xF9, 0x77, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x74, 0x9F, 0xFF, 0xFF, 0x97, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x49, 0xFF, 0xFF, 0xFA, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x76, 0xFF, 0xFF, 0xFC, 0x67, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x9F, 0xFF, 0xFF, 0xC4, 0x36, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0xFF, 0xFF, 0xFC, 0x33, 0x46, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x9F, 0xFF, 0xFF, 0xC3, 0x34, 0x78, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x79, 0xFF, 0xFF, 0xFD, 0x33, 0x47, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x8F, 0xFF, 0xFF, 0xD3, 0x44, 0x78, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0xFF, 0xFF, 0xFC, 0x34, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x77, 0x8F, 0xFF, 0xFF, 0xC3, 0x44, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x78, 0xFF, 0xFF, 0xFC, 0x33, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x9F, 0xFF, 0xFF, 0xC4, 0x34, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x8A, 0xFF, 0xFC, 0x43, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x84, 0x8F, 0xC4, 0x34, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x4A, 0x53, 0x47, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x34, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x56, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88
+extern const uint8_t right_32x32x4[227] = {
+  0xF8, 0xF8, 0xF8, 0xF8, 0x98, 0x37, 0xF8, 0x98, 0x17, 0x08, 0x0F, 0x0A, 0x17, 0xF8, 0x78, 0x17,
+  0x08, 0x2F, 0x09, 0x17, 0xF8, 0x68, 0x07, 0x08, 0x4F, 0x09, 0x17, 0xF8, 0x58, 0x17, 0x0B, 0x4F,
+  0x09, 0x17, 0xF8, 0x68, 0x04, 0x0A, 0x4F, 0x09, 0x17, 0xF8, 0x68, 0x03, 0x0A, 0x4F, 0x09, 0x17,
+  0xF8, 0x68, 0x03, 0x0A, 0x4F, 0x09, 0x17, 0xF8, 0x68, 0x03, 0x0A, 0x4F, 0x09, 0x17, 0xF8, 0x68,
+  0x03, 0x0A, 0x4F, 0x09, 0x17, 0xF8, 0x68, 0x04, 0x0A, 0x4F, 0x09, 0x17, 0xF8, 0x58, 0x07, 0x04,
+  0x09, 0x4F, 0x09, 0x17, 0xF8, 0x58, 0x07, 0x04, 0x09, 0x4F, 0x0A, 0xF8, 0x78, 0x07, 0x06, 0x4F,
+  0x0C, 0x06, 0x07, 0xF8, 0x38, 0x17, 0x09, 0x4F, 0x0C, 0x04, 0x03, 0x06, 0xF8, 0x28, 0x17, 0x09,
+  0x4F, 0x0C, 0x13, 0x04, 0x06, 0xF8, 0x18, 0x17, 0x09, 0x4F, 0x0C, 0x13, 0x04, 0x07, 0xF8, 0x18,
+  0x17, 0x09, 0x4F, 0x0D, 0x13, 0x04, 0x07, 0xF8, 0x28, 0x07, 0x08, 0x4F, 0x0D, 0x03, 0x14, 0x07,
+  0xF8, 0x28, 0x07, 0x08, 0x4F, 0x0C, 0x03, 0x14, 0x07, 0xF8, 0x18, 0x17, 0x08, 0x4F, 0x0C, 0x03,
+  0x14, 0x07, 0xF8, 0x18, 0x17, 0x08, 0x4F, 0x0C, 0x13, 0x04, 0x07, 0xF8, 0x28, 0x07, 0x09, 0x4F,
+  0x0C, 0x04, 0x03, 0x04, 0x07, 0xF8, 0x38, 0x07, 0x08, 0x0A, 0x2F, 0x0C, 0x04, 0x03, 0x04, 0x07,
+  0xF8, 0x68, 0x04, 0x08, 0x0F, 0x0C, 0x04, 0x03, 0x04, 0x07, 0xF8, 0x88, 0x04, 0x0A, 0x05, 0x03,
+  0x04, 0x07, 0xF8, 0xA8, 0x04, 0x03, 0x04, 0x07, 0xF8, 0xB8, 0x07, 0x05, 0x06, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0x18
 };
 
 #endif // HAS_GRAPHICAL_TFT
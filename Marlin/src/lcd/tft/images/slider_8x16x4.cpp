@@ -24,23 +24,10 @@
 
 #if HAS_GRAPHICAL_TFT
 
-extern const uint8_t slider_8x16x4[64] = {
-  0x88, 0xFF, 0xFF, 0x88,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x8F, 0xFF, 0xFF, 0xF8,
-  0x88, 0xFF, 0xFF, 0x88,
+extern const uint8_t slider_8x16x4[33] = {
+  0x18, 0x3F, 0x28, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F,
+  0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x18, 0x5F, 0x28, 0x3F,
+  0x18
 };
 
 #endif // HAS_GRAPHICAL_TFT
@@ -35,6 +35,9 @@ uint16_t TFT::buffer[];
 void TFT::init() {
   io.Init();
   io.InitTFT();
+  #ifdef TFT_DIRTY_RECTS
+    queue.invalidate();
+  #endif
 }
 
 TFT tft;
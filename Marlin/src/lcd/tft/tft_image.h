@@ -106,7 +106,9 @@ enum colorMode_t : uint8_t {
   GREYSCALE1 = 0x01,  // 1 bit per pixel
   GREYSCALE2,         // 2 bits per pixel
   GREYSCALE4,         // 4 bits per pixel
-  HIGHCOLOR           // 16 bits per pixel
+  HIGHCOLOR,          // 16 bits per pixel
+  GREYSCALE4_RLE,     // 4 bits per pixel, run-length encoded
+  HIGHCOLOR_RLE       // 16 bits per pixel, run-length encoded
 };
 
 typedef colorMode_t ColorMode;
@@ -33,9 +33,62 @@ uint8_t *TFT_Queue::end_of_queue = queue;
 uint8_t *TFT_Queue::current_task = NULL;
 uint8_t *TFT_Queue::last_task = NULL;
 
+#ifdef TFT_DIRTY_RECTS
+
+  typedef struct {
+    uint16_t x, y, width, height;
+    uint32_t hash;
+  } drawnRect_t;
+
+  // Rectangles whose pixels are still on screen, oldest first
+  static drawnRect_t drawn[TFT_DIRTY_RECTS];
+  static uint8_t drawn_count = 0;
+
+  void TFT_Queue::invalidate() { drawn_count = 0; }
+
+  /**
+   * Return true if an identical task was drawn and nothing has drawn over it
+   * since. Otherwise record the task, forgetting every rectangle it overlaps.
+   * The hash covers the task parameters, so for a canvas it includes every
+   * text, image and bar queued into it.
+   */
+  bool TFT_Queue::unchanged(queueTask_t *task) {
+    const parametersFill_t *rect = (parametersFill_t *)(((uint8_t *)task) + sizeof(queueTask_t));
+    const uint8_t *end = task->type == TASK_FILL ? (uint8_t *)rect + sizeof(parametersFill_t) : task->nextTask;
+
+    uint32_t hash = 0x811C9DC5;                           // FNV-1a
+    for (const uint8_t *p = (uint8_t *)rect; p < end; p++) hash = (hash ^ *p) * 0x01000193;
+
+    const uint16_t x = rect->x, y = rect->y, width = rect->width, height = rect->height;
+    LOOP_L_N(i, drawn_count) {
+      const drawnRect_t &r = drawn[i];
+      if (r.hash == hash && r.x == x && r.y == y && r.width == width && r.height == height) return true;
+    }
+
+    uint8_t n = 0;
+    LOOP_L_N(i, drawn_count) {
+      const drawnRect_t &r = drawn[i];
+      if (r.x < x + width && x < r.x + r.width && r.y < y + height && y < r.y + r.height) continue;
+      drawn[n++] = r;
+    }
+    if (n == COUNT(drawn)) {                              // Full. Forget the oldest.
+      memmove(drawn, drawn + 1, sizeof(drawnRect_t) * --n);
+    }
+    drawn[n++] = { x, y, width, height, hash };
+    drawn_count = n;
+    return false;
+  }
+
+#endif // TFT_DIRTY_RECTS
+
 void TFT_Queue::reset() {
   tft.abort();
 
+  #ifdef TFT_DIRTY_RECTS
+    // Tasks dropped before they finished leave unknown pixels behind
+    if (current_task != NULL && ((queueTask_t *)current_task)->type != TASK_END_OF_QUEUE) invalidate();
+  #endif
+
   end_of_queue = queue;
   current_task = NULL;
   last_task = NULL;
@@ -55,6 +108,15 @@ void TFT_Queue::async() {
 
   finish_sketch();
 
+  #ifdef TFT_DIRTY_RECTS
+    // Pass over tasks whose pixels are already on screen
+    while (task->type != TASK_END_OF_QUEUE && task->state == TASK_STATE_READY && unchanged(task)) {
+      task = (queueTask_t *)task->nextTask;
+      current_task = (uint8_t *)task;
+      finish_sketch();
+    }
+  #endif
+
   switch (task->type) {
     case TASK_END_OF_QUEUE: reset();      break;
     case TASK_FILL:         fill(task);   break;
@@ -140,6 +202,7 @@ void TFT_Queue::canvas(queueTask_t *task) {
             item += sizeof(uint16_t) * 3;
             break;
           case GREYSCALE4:
+          case GREYSCALE4_RLE:
             item += sizeof(uint16_t) * 15;
             break;
           default:
@@ -257,7 +320,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   colorMode_t color_mode = Images[image].colorMode;
 
-  if (color_mode == HIGHCOLOR) return;
+  if (color_mode == HIGHCOLOR || color_mode == HIGHCOLOR_RLE) return;
 
   uint16_t *color = (uint16_t *)end_of_queue;
   uint8_t number_of_color = 0;
@@ -265,7 +328,8 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
   switch (color_mode) {
     case GREYSCALE1:  number_of_color =  1; break;
     case GREYSCALE2:  number_of_color =  3; break;
-    case GREYSCALE4:  number_of_color = 15; break;
+    case GREYSCALE4:
+    case GREYSCALE4_RLE: number_of_color = 15; break;
     default:
       break;
   }
@@ -301,6 +365,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t colo
         colors[i] = gradient(color_main, color_background, (i << 8) / 3);
       break;
     case GREYSCALE4:
+    case GREYSCALE4_RLE:
       for (i = 1; i < 8; i++)
         colors[i] = gradient(color_background, color_shadow, i << 5);
       for (i = 8; i < 16; i++)
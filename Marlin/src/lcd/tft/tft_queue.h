@@ -122,8 +122,15 @@ class TFT_Queue {
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
 
+    #ifdef TFT_DIRTY_RECTS
+      static bool unchanged(queueTask_t *task);
+    #endif
+
   public:
     static void reset();
+    #ifdef TFT_DIRTY_RECTS
+      static void invalidate();
+    #endif
     static void async();
     static void sync() { while (current_task != NULL) async(); }
 
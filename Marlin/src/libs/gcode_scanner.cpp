@@ -0,0 +1,176 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if NEED_GCODE_SCANNER
+
+#include "gcode_scanner.h"
+
+#include <stdlib.h>
+
+GCodeScanner::LineType GCodeScanner::scan(const char *line) {
+  while (*line == ' ') line++;
+
+  // Skip a line number
+  if (*line == 'N') {
+    while (*line && *line != ' ') line++;
+    while (*line == ' ') line++;
+  }
+
+  letter = '\0';
+  if (*line == ';') return SCAN_COMMENT;
+  if (*line != 'G' && *line != 'M' && *line != 'T') return SCAN_OTHER;
+
+  char *end;
+  codenum = strtol(line + 1, &end, 10);
+  if (end == line + 1) return SCAN_OTHER;
+  letter = *line;
+  if (letter == 'T') return SCAN_OTHER;
+
+  // Gather the axis and arc words
+  xyze_float_t val;
+  xy_float_t ij = { 0, 0 };
+  float fval = 0, rval = 0;
+  uint8_t seen = 0;
+  bool seen_r = false;
+  for (const char *p = end; *p && *p != ';' && *p != '('; p++) {
+    int8_t axis = -1;
+    float *v;
+    switch (*p) {
+      case 'X': axis = X_AXIS; break;
+      case 'Y': axis = Y_AXIS; break;
+      case 'Z': axis = Z_AXIS; break;
+      case 'E': axis = E_AXIS; break;
+      case 'I': v = &ij.x; break;
+      case 'J': v = &ij.y; break;
+      case 'R': v = &rval; break;
+      case 'F': v = &fval; break;
+      default: continue;
+    }
+    if (axis >= 0) v = &val[axis];
+    *v = strtof(p + 1, &end);
+    if (end == p + 1) continue;
+    p = end - 1;
+    if (axis >= 0) SBI(seen, axis);
+    else if (v == &rval) seen_r = true;
+  }
+
+  if (letter == 'M') {
+    if (codenum == 82) relative_e = false;
+    else if (codenum == 83) relative_e = true;
+    return SCAN_OTHER;
+  }
+
+  switch (codenum) {
+    case 0: case 1: case 2: case 3: {
+      start = pos;
+      if (fval > 0) feedrate = MMM_TO_MMS(fval);
+      LOOP_XYZ(i) if (TEST(seen, i)) pos[i] = relative_xyz ? pos[i] + val[i] : val[i];
+      if (TEST(seen, E_AXIS)) pos.e = relative_e ? pos.e + val.e : val.e;
+
+      // The arc center offset, as G2/G3 finds it
+      xy_float_t offset = { 0, 0 };
+      if (codenum >= 2) {
+        if (!seen_r)
+          offset = ij;
+        else if (rval && (pos.x != start.x || pos.y != start.y)) {
+          const xy_float_t d2 = (xy_pos_t(pos) - xy_pos_t(start)) * 0.5f;
+          const float e = (codenum == 2) ^ (rval < 0) ? -1 : 1,
+                      len = d2.magnitude(),
+                      h2 = (rval - len) * (rval + len),
+                      h = h2 >= 0 ? SQRT(h2) : 0.0f;
+          const xy_float_t s = { -d2.y, d2.x };
+          offset = d2 + s / len * e * h;
+        }
+      }
+      if (offset) setArc(codenum == 2, offset); else setLine();
+
+      const bool moved_xy = sweep || TEST(seen, X_AXIS) || TEST(seen, Y_AXIS);
+      return (moved_xy && pos.e > start.e) ? SCAN_EXTRUDE : SCAN_MOVE;
+    }
+    case 28:
+      LOOP_XYZ(i) if (!seen || TEST(seen, i)) pos[i] = 0;
+      return SCAN_MOVE;
+    case 90: relative_xyz = relative_e = false; break;
+    case 91: relative_xyz = relative_e = true; break;
+    case 92: LOOP_XYZE(i) if (TEST(seen, i)) pos[i] = val[i]; break;
+  }
+  return SCAN_OTHER;
+}
+
+void GCodeScanner::setLine() {
+  const xyz_float_t d = pos - start;
+  length = d.magnitude();
+  sweep = 0;
+  lo.set(_MIN(start.x, pos.x), _MIN(start.y, pos.y));
+  hi.set(_MAX(start.x, pos.x), _MAX(start.y, pos.y));
+}
+
+// Measure an arc the way plan_arc sweeps it, including a full circle
+void GCodeScanner::setArc(const bool clockwise, const xy_float_t &offset) {
+  const xy_float_t r0 = -offset;
+  center = xy_pos_t(start) + offset;
+  const xy_float_t r1 = xy_pos_t(pos) - center;
+  const float radius = r0.magnitude();
+
+  sweep = ATAN2(r0.x * r1.y - r0.y * r1.x, r0.x * r1.x + r0.y * r1.y);
+  if (sweep < 0) sweep += RADIANS(360);
+  if (clockwise) sweep -= RADIANS(360);
+  if (sweep == 0 && pos.x == start.x && pos.y == start.y) sweep = RADIANS(360);
+
+  const float flat = radius * sweep, dz = pos.z - start.z;
+  length = SQRT(flat * flat + dz * dz);
+
+  // Widen the chord bounds by each axis extreme the arc passes
+  lo.set(_MIN(start.x, pos.x), _MIN(start.y, pos.y));
+  hi.set(_MAX(start.x, pos.x), _MAX(start.y, pos.y));
+  const float a0 = ATAN2(r0.y, r0.x);
+  LOOP_L_N(q, 4) {
+    float a = RADIANS(90) * q - a0;
+    if (sweep < 0) a = -a;
+    while (a < 0) a += RADIANS(360);
+    while (a >= RADIANS(360)) a -= RADIANS(360);
+    if (a > ABS(sweep)) continue;
+    switch (q) {
+      case 0: NOLESS(hi.x, center.x + radius); break;
+      case 1: NOLESS(hi.y, center.y + radius); break;
+      case 2: NOMORE(lo.x, center.x - radius); break;
+      case 3: NOMORE(lo.y, center.y - radius); break;
+    }
+  }
+}
+
+xyz_float_t GCodeScanner::direction(const bool at_end) const {
+  xyz_float_t d = { 0, 0, 0 };
+  if (length <= 0) return d;
+  if (sweep) {
+    // The tangent turns with the arc
+    const xy_float_t r = xy_pos_t(at_end ? pos : start) - center;
+    d.set(-r.y * sweep / length, r.x * sweep / length, (pos.z - start.z) / length);
+  }
+  else
+    d = (pos - start) / length;
+  return d;
+}
+
+#endif // NEED_GCODE_SCANNER
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * libs/gcode_scanner.h - Lightweight G-code tracker for job pre-scans
+ *
+ * Follows the position and feedrate through G0-G3, G28, G90/G91, G92
+ * and M82/M83 without the planner or the shared GCodeParser, so a file
+ * can be scanned while a command is still being executed. G2/G3 arcs
+ * (I J or R, in the XY plane) are measured along the arc.
+ */
+
+#include "../core/types.h"
+
+class GCodeScanner {
+public:
+  enum LineType : uint8_t { SCAN_OTHER, SCAN_COMMENT, SCAN_MOVE, SCAN_EXTRUDE };
+
+  xyze_pos_t start,   // Position before the last move
+             pos;     // Position after the last line
+  feedRate_t feedrate; // (mm/s) From the last F word of a move
+  bool relative_xyz, relative_e;
+  char letter;        // Command letter and number of the last line ('\0' for none)
+  int16_t codenum;
+
+  float length;       // (mm) XYZ path length of the last move
+  xy_pos_t lo, hi;    // XY bounds of the last move's path
+  xy_pos_t center;    // Arc center of the last move
+  float sweep;        // (rad) Arc angle of the last move, CCW positive, 0 for a line
+
+  GCodeScanner() { reset(); }
+
+  void reset() {
+    start.reset(); pos.reset();
+    feedrate = MMM_TO_MMS(1500);
+    relative_xyz = relative_e = false;
+    letter = '\0'; codenum = 0;
+    length = sweep = 0;
+    lo.reset(); hi.reset(); center.reset();
+  }
+
+  // Scan a single NUL-terminated line. Comments are allowed.
+  LineType scan(const char *line);
+
+  // Unit direction of the last move at its start or end
+  xyz_float_t direction(const bool at_end) const;
+
+private:
+  void setLine();
+  void setArc(const bool clockwise, const xy_float_t &offset);
+};
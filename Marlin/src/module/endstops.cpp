@@ -290,8 +290,14 @@ void Endstops::poll() {
 
   #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
     update();
-  #elif ENDSTOP_NOISE_THRESHOLD
-    if (endstop_poll_count) update();
+  #else
+    #if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+      // The stepper ISR may stop the last Z motor after its pin interrupt ran
+      if (stepper.separate_multi_axis) { update(); return; }
+    #endif
+    #if ENDSTOP_NOISE_THRESHOLD
+      if (endstop_poll_count) update();
+    #endif
   #endif
 }
 
@@ -331,6 +337,11 @@ void Endstops::not_homing() {
 void Endstops::resync() {
   if (!abort_enabled()) return;     // If endstops/probes are disabled the loop below can hang
 
+  // The state went stale while update() was skipped. Validate it afresh.
+  #if ENDSTOP_NOISE_THRESHOLD && ENABLED(ENDSTOPS_POLL_ONLY_WHEN_ENABLED)
+    endstop_poll_count = ENDSTOP_NOISE_THRESHOLD;
+  #endif
+
   // Wait for Temperature ISR to run at least once (runs at 1KHz)
   TERN(ENDSTOP_INTERRUPTS_FEATURE, update(), safe_delay(2));
   while (TERN0(ENDSTOP_NOISE_THRESHOLD, endstop_poll_count)) safe_delay(1);
@@ -492,7 +503,7 @@ void _O2 Endstops::report_states() {
 // Check endstops - Could be called from Temperature ISR!
 void Endstops::update() {
 
-  #if !ENDSTOP_NOISE_THRESHOLD
+  #if !ENDSTOP_NOISE_THRESHOLD || ENABLED(ENDSTOPS_POLL_ONLY_WHEN_ENABLED)
     if (!abort_enabled()) return;
   #endif
 
@@ -637,6 +648,19 @@ void Endstops::update() {
     #endif
   #endif
 
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+    // Latch the steps when an endstop the move runs into rises.
+    // The noise filter and the poll come later.
+    static esbits_t prev_live_state;
+    esbits_t facing = 0;
+    if (stepper.axis_is_moving(X_AXIS)) SBI(facing, stepper.motor_direction(X_AXIS_HEAD) ? X_MIN : X_MAX);
+    if (stepper.axis_is_moving(Y_AXIS)) SBI(facing, stepper.motor_direction(Y_AXIS_HEAD) ? Y_MIN : Y_MAX);
+    if (stepper.axis_is_moving(Z_AXIS))
+      SBI(facing, stepper.motor_direction(Z_AXIS_HEAD) ? TERN(HAS_CUSTOM_PROBE_PIN, z_probe_enabled ? Z_MIN_PROBE : Z_MIN, Z_MIN) : Z_MAX);
+    if (live_state & ~prev_live_state & facing) stepper.latch_edge_position();
+    prev_live_state = live_state;
+  #endif
+
   #if ENDSTOP_NOISE_THRESHOLD
 
     /**
@@ -705,6 +729,16 @@ void Endstops::update() {
     } \
   }while(0)
 
+  // Stop dual Z when both motors have stopped at their endstops
+  #define PROCESS_SYNC_ENDSTOP(A, MINMAX) do { \
+    const byte dual_hit = TEST_ENDSTOP(_ENDSTOP(A, MINMAX)) | (TEST_ENDSTOP(_ENDSTOP(A##2, MINMAX)) << 1); \
+    if (dual_hit) { \
+      _ENDSTOP_HIT(A, MINMAX); \
+      if (!stepper.separate_multi_axis || stepper.z_sync_stopped()) \
+        planner.endstop_triggered(_AXIS(A)); \
+    } \
+  }while(0)
+
   #define PROCESS_QUAD_ENDSTOP(A, MINMAX) do { \
     const byte quad_hit = TEST_ENDSTOP(_ENDSTOP(A, MINMAX)) | (TEST_ENDSTOP(_ENDSTOP(A##2, MINMAX)) << 1) | (TEST_ENDSTOP(_ENDSTOP(A##3, MINMAX)) << 2) | (TEST_ENDSTOP(_ENDSTOP(A##4, MINMAX)) << 3); \
     if (quad_hit) { \
@@ -733,6 +767,8 @@ void Endstops::update() {
     #define PROCESS_ENDSTOP_Z(MINMAX) PROCESS_QUAD_ENDSTOP(Z, MINMAX)
   #elif NUM_Z_STEPPER_DRIVERS == 3
     #define PROCESS_ENDSTOP_Z(MINMAX) PROCESS_TRIPLE_ENDSTOP(Z, MINMAX)
+  #elif ENABLED(Z_MULTI_HOMING_ISR_STOP)
+    #define PROCESS_ENDSTOP_Z(MINMAX) PROCESS_SYNC_ENDSTOP(Z, MINMAX)
   #else
     #define PROCESS_ENDSTOP_Z(MINMAX) PROCESS_DUAL_ENDSTOP(Z, MINMAX)
   #endif
@@ -1640,6 +1640,17 @@ void homeaxis(const AxisEnum axis) {
     #endif
   }
 
+  #if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+    if (axis == Z_AXIS && DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Z2 skew:", stepper.z_sync_skew() * planner.steps_to_mm[Z_AXIS]);
+  #endif
+
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE) && NONE(IS_SCARA, DELTA)
+    // Distance run past the endstop edge before the stop. The edge latch only
+    // sees the first of multiple endstops, so leave those axes uncorrected.
+    const bool multi_endstop = TERN0(X_DUAL_ENDSTOPS, axis == X_AXIS) || TERN0(Y_DUAL_ENDSTOPS, axis == Y_AXIS) || TERN0(Z_MULTI_ENDSTOPS, axis == Z_AXIS);
+    const float overrun = multi_endstop ? 0.0f : stepper.trigger_overrun(axis) * planner.steps_to_mm[axis];
+  #endif
+
   #if HAS_EXTRA_ENDSTOPS
     const bool pos_dir = axis_home_dir > 0;
     #if ENABLED(X_DUAL_ENDSTOPS)
@@ -1802,6 +1813,10 @@ void homeaxis(const AxisEnum axis) {
   #else // CARTESIAN / CORE / MARKFORGED_XY
 
     set_axis_is_at_home(axis);
+    TERN_(ENDSTOP_EDGE_CAPTURE, current_position[axis] += overrun);
+    #if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+      if (axis == Z_AXIS) current_position.z += stepper.z_sync_overrun() * planner.steps_to_mm[Z_AXIS];
+    #endif
     sync_plan_position();
 
     destination[axis] = current_position[axis];
@@ -144,6 +144,10 @@ enum BlockFlag : char {
  * A single entry in the planner buffer.
  * Tracks linear movement over multiple axes.
  *
+ * This is the execution record read by the Stepper ISR. Fields that only
+ * the lookahead and the main thread use are kept in block_plan_t, so the
+ * ISR's record stays small and the buffer takes less RAM.
+ *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
  */
@@ -151,18 +155,7 @@ typedef struct block_t {
 
   volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
-  union {
-    abce_ulong_t steps;                     // Step count along each axis
-    abce_long_t position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -170,7 +163,25 @@ typedef struct block_t {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Normalized color for the mixing steppers
+  TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Shared color for the mixing steppers
+
+  // Advance extrusion
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
+    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
+             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
+             final_adv_steps;               // advance steps due to exit speed
+  #endif
+
+  #if ENABLED(DIRECT_STEPPING)
+    page_idx_t page_idx;                    // Page index used for direct stepping
+  #endif
+
+  union {
+    abce_ulong_t steps;                     // Step count along each axis
+    abce_long_t position;                   // New position to force when this sync block is executed
+  };
+  uint32_t step_event_count;                // The number of step events required to complete this block
 
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
@@ -186,38 +197,15 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
-  // Advance extrusion
-  #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
-    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
-             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
-             final_adv_steps;               // advance steps due to exit speed
-    float e_D_ratio;
-  #endif
-
+  // Step rates and timer counts stay 32-bit. They can exceed 16 bits on the 32-bit HALs.
   uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
            initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
-
-  #if ENABLED(DIRECT_STEPPING)
-    page_idx_t page_idx;                    // Page index used for direct stepping
-  #endif
+           final_rate;                      // The minimal rate at exit
 
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
-  #endif
-
   #if HAS_WIRED_LCD
     uint32_t segment_time_us;
   #endif
@@ -232,6 +220,44 @@ typedef struct block_t {
 
 } block_t;
 
+/**
+ * struct block_plan_t
+ *
+ * The planning record kept beside each block_t, at the same buffer index.
+ * Only the lookahead and the main thread read these fields.
+ */
+typedef struct block_plan_t {
+
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
+
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(LIN_ADVANCE)
+    float e_D_ratio;
+  #endif
+
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
+} block_plan_t;
+
+// Guard the record sizes for the common feature set. Move new fields that
+// the Stepper ISR doesn't need into block_plan_t instead of block_t.
+#if NONE(LASER_POWER_INLINE, DIRECT_STEPPING) && !HAS_CUTTER
+  static_assert(sizeof(block_t) <= 96, "block_t is too large. Put planner-only fields in block_plan_t.");
+#endif
+static_assert(sizeof(block_plan_t) <= 40, "block_plan_t is too large.");
+
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL)
   #define HAS_POSITION_FLOAT 1
 #endif
@@ -304,6 +330,7 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
+    static block_plan_t block_plan[BLOCK_BUFFER_SIZE]; // Planning records, same index as block_buffer
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_planned,   // Index of the optimally planned block
@@ -373,6 +400,9 @@ class Planner {
 
     #if ENABLED(LIN_ADVANCE)
       static float extruder_advance_K[EXTRUDERS];
+      #if ENABLED(MIXING_EXTRUDER)
+        static float mixing_advance_K;        // K for blocks that blend more than one input
+      #endif
     #endif
 
     /**
@@ -636,6 +666,9 @@ class Planner {
     // Get count of movement slots free
     FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
 
+    // The planning record that goes with a block in block_buffer
+    FORCE_INLINE static block_plan_t& plan_for(const block_t * const block) { return block_plan[block - block_buffer]; }
+
     /**
      * Planner::get_next_free_block
      *
@@ -940,6 +973,21 @@ class Planner {
       }
     #endif
 
+    #if ENABLED(LIN_ADVANCE)
+      // The advance K for a block. Blended mixes have their own K.
+      static float block_advance_K(const block_t * const block) {
+        #if ENABLED(MIXING_EXTRUDER)
+          uint8_t inputs = 0;
+          const mixer_comp_t * const b_color = mixer.block_color[block->color_idx];
+          MIXER_STEPPER_LOOP(i) if (b_color[i]) inputs++;
+          if (inputs > 1) return mixing_advance_K;
+        #else
+          UNUSED(block);
+        #endif
+        return extruder_advance_K[active_extruder];
+      }
+    #endif
+
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
     static void reverse_pass_kernel(block_t* const current, const block_t * const next);
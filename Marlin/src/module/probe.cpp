@@ -48,7 +48,7 @@
   #include "delta.h"
 #endif
 
-#if ENABLED(BABYSTEP_ZPROBE_OFFSET)
+#if ANY(BABYSTEP_ZPROBE_OFFSET, FAST_MESH_PROBING, ENDSTOP_EDGE_CAPTURE)
   #include "planner.h"
 #endif
 
@@ -71,6 +71,8 @@
 #if ENABLED(SENSORLESS_PROBING)
   #include "stepper.h"
   #include "../feature/tmc_util.h"
+#elif ENABLED(ENDSTOP_EDGE_CAPTURE)
+  #include "stepper.h"
 #endif
 
 #if QUIET_PROBING
@@ -92,6 +94,14 @@ xyz_pos_t Probe::offset; // Initialized by settings.load()
   const xyz_pos_t &Probe::offset_xy = Probe::offset;
 #endif
 
+#if ENABLED(FAST_MESH_PROBING)
+  Probe::fast_mesh_t Probe::fast_mesh;
+#endif
+
+#if ENABLED(ENDSTOP_EDGE_CAPTURE) && NONE(IS_SCARA, DELTA)
+  float Probe::trigger_z;
+#endif
+
 #if ENABLED(Z_PROBE_SLED)
 
   #ifndef SLED_DOCKING_OFFSET
@@ -490,6 +500,12 @@ bool Probe::probe_down_to_z(const float z, const feedRate_t fr_mm_s) {
   // Tell the planner where we actually are
   sync_plan_position();
 
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE) && NONE(IS_SCARA, DELTA)
+    // The probe switched before the steppers stopped. Measure from the edge.
+    trigger_z = current_position.z;
+    if (probe_triggered) trigger_z -= stepper.trigger_overrun(Z_AXIS) * planner.steps_to_mm[Z_AXIS];
+  #endif
+
   return !probe_triggered;
 }
 
@@ -511,7 +527,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   auto try_to_probe = [&](PGM_P const plbl, const float &z_probe_low_point, const feedRate_t fr_mm_s, const bool scheck, const float clearance) {
     // Do a first probe at the fast speed
     const bool probe_fail = probe_down_to_z(z_probe_low_point, fr_mm_s),            // No probe trigger?
-               early_fail = (scheck && current_position.z > -offset.z + clearance); // Probe triggered too high?
+               early_fail = (scheck && triggered_z() > -offset.z + clearance);      // Probe triggered too high?
     #if ENABLED(DEBUG_LEVELING_FEATURE)
       if (DEBUGGING(LEVELING) && (probe_fail || early_fail)) {
         DEBUG_PRINT_P(plbl);
@@ -537,7 +553,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     if (try_to_probe(PSTR("FAST"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_SPEED_FAST),
                      sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
 
-    const float first_probe_z = current_position.z;
+    const float first_probe_z = triggered_z();
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("1st Probe Z:", first_probe_z);
 
@@ -577,7 +593,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
       TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
 
-      const float z = current_position.z;
+      const float z = triggered_z();
 
       #if EXTRA_PROBING > 0
         // Insert Z measurement into probes[]. Keep it sorted ascending.
@@ -628,7 +644,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
   #elif TOTAL_PROBING == 2
 
-    const float z2 = current_position.z;
+    const float z2 = triggered_z();
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("2nd Probe Z:", z2, " Discrepancy:", first_probe_z - z2);
 
@@ -638,7 +654,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   #else
 
     // Return the single probe result
-    const float measured_z = current_position.z;
+    const float measured_z = triggered_z();
 
   #endif
 
@@ -723,6 +739,146 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   return measured_z;
 }
 
+#if ENABLED(FAST_MESH_PROBING)
+
+  void Probe::fast_mesh_start() {
+    fast_mesh = fast_mesh_t();
+    fast_mesh.last_z = NAN;
+    fast_mesh.bias_min = 999;
+    fast_mesh.bias_max = -999;
+    fast_mesh.start_ms = millis();
+  }
+
+  /**
+   * Probe one mesh point with a blended approach.
+   *
+   * The lift off the last touch and the travel to the next point are queued
+   * together so the planner runs them as one path. After the first point
+   * the travel ends FAST_MESH_APPROACH above the last touch, so the descent
+   * overlaps the XY move and only a short probe remains. Where the last touch
+   * was low the travel stays FAST_MESH_MIN_CLEARANCE over Z0. The first point
+   * is approached from Z_CLEARANCE_DEPLOY_PROBE like a normal probe.
+   *
+   * With FAST_MESH_REUSE_TOUCH the fast touch is compared with the slow one
+   * for the first few points. Once they agree within tolerance the fast
+   * touch (less the mean difference) is used alone.
+   *
+   * Return the probed Z position or NAN on error.
+   */
+  float Probe::probe_mesh_point(const xy_pos_t &pos, const uint8_t verbose_level/*=0*/) {
+    DEBUG_SECTION(log_probe, "Probe::probe_mesh_point", DEBUGGING(LEVELING));
+
+    if (!can_reach(pos)) {
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Position Not Reachable");
+      return NAN;
+    }
+
+    #if BOTH(BLTOUCH, BLTOUCH_HS_MODE)
+      if (bltouch.triggered()) bltouch._reset();
+    #endif
+
+    xy_pos_t npos = pos;
+    npos -= offset_xy;                                      // Get the nozzle position
+
+    //
+    // Travel
+    //
+    millis_t ms = millis();
+    const bool near_bed = !isnan(fast_mesh.last_z);
+    const float clear_z = (FAST_MESH_MIN_CLEARANCE) + (offset.z < 0 ? -offset.z : 0);
+    if (near_bed) {
+      current_position.z = _MAX(fast_mesh.last_z + (FAST_MESH_LIFT), clear_z);
+      line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
+    else
+      do_z_raise(_MAX(Z_CLEARANCE_BETWEEN_PROBES, Z_CLEARANCE_DEPLOY_PROBE));
+    current_position.set(npos.x, npos.y, near_bed ? _MAX(fast_mesh.last_z + (FAST_MESH_APPROACH), clear_z) : current_position.z);
+    line_to_current_position(XY_PROBE_FEEDRATE_MM_S);
+    planner.synchronize();
+
+    const uint8_t probe_bit = TERN(Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN, Z_MIN, Z_MIN_PROBE);
+    if (TEST(endstops.trigger_state(), probe_bit)) {
+      // Touched down on the way. Recover the position and probe normally.
+      endstops.hit_on_purpose();
+      set_current_from_steppers_for_axis(ALL_AXES);
+      sync_plan_position();
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      fast_mesh.last_z = NAN;
+      fast_mesh.travel_ms += millis() - ms;
+      return probe_at_point(pos, PROBE_PT_RAISE, verbose_level);
+    }
+
+    const millis_t now = millis();
+    fast_mesh.travel_ms += now - ms;
+    ms = now;
+
+    //
+    // Touch
+    //
+    const float z_probe_low_point = -offset.z + Z_PROBE_LOW_POINT;
+    auto touch = [&](const feedRate_t fr_mm_s) {
+      return probe_down_to_z(z_probe_low_point, fr_mm_s)                    // No probe trigger?
+          || triggered_z() > -offset.z + Z_CLEARANCE_BETWEEN_PROBES;       // Probe triggered too high?
+    };
+
+    float measured_z = NAN;
+    if (!deploy() && !touch(MMM_TO_MMS(Z_PROBE_SPEED_FAST))) {
+      const float fast_z = triggered_z();
+      #if ENABLED(FAST_MESH_REUSE_TOUCH)
+        if (fast_mesh.reuse) {
+          measured_z = fast_z - fast_mesh.bias_sum / fast_mesh.checks;
+          fast_mesh.reused++;
+        }
+        else
+      #endif
+      {
+        do_blocking_move_to_z(fast_z + (FAST_MESH_APPROACH), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+        if (!touch(MMM_TO_MMS(Z_PROBE_SPEED_SLOW))) {
+          measured_z = triggered_z();
+          #if ENABLED(FAST_MESH_REUSE_TOUCH)
+            const float bias = fast_z - measured_z;
+            fast_mesh.bias_sum += bias;
+            NOMORE(fast_mesh.bias_min, bias);
+            NOLESS(fast_mesh.bias_max, bias);
+            if (++fast_mesh.checks >= FAST_MESH_REUSE_CHECKS)
+              fast_mesh.reuse = fast_mesh.bias_max - fast_mesh.bias_min <= FAST_MESH_REUSE_TOLERANCE;
+          #endif
+        }
+      }
+    }
+
+    fast_mesh.probe_ms += millis() - ms;
+
+    if (isnan(measured_z)) {
+      fast_mesh.last_z = NAN;
+      stow();
+      LCD_MESSAGEPGM(MSG_LCD_PROBING_FAILED);
+      #if DISABLED(G29_RETRY_AND_RECOVER)
+        SERIAL_ERROR_MSG(STR_ERR_PROBING_FAILED);
+      #endif
+      return NAN;
+    }
+
+    fast_mesh.last_z = current_position.z;
+    fast_mesh.points++;
+
+    measured_z += offset.z;
+    if (verbose_level > 2)
+      SERIAL_ECHOLNPAIR("Bed X: ", LOGICAL_X_POSITION(pos.x), " Y: ", LOGICAL_Y_POSITION(pos.y), " Z: ", measured_z);
+
+    return measured_z;
+  }
+
+  // Raise clear of the bed and report where the time went
+  void Probe::fast_mesh_finish() {
+    if (!isnan(fast_mesh.last_z))
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    SERIAL_ECHOLNPAIR("Mesh probing: ", fast_mesh.points, " points (", fast_mesh.reused, " reused)"
+      " Travel: ", fast_mesh.travel_ms, "ms Probing: ", fast_mesh.probe_ms, "ms Total: ", millis() - fast_mesh.start_ms, "ms");
+  }
+
+#endif // FAST_MESH_PROBING
+
 #if HAS_Z_SERVO_PROBE
 
   void Probe::servo_probe_init() {
@@ -89,6 +89,12 @@ public:
       return probe_at_point(pos.x, pos.y, raise_after, verbose_level, probe_relative, sanity_check);
     }
 
+    #if ENABLED(FAST_MESH_PROBING)
+      static void fast_mesh_start();
+      static float probe_mesh_point(const xy_pos_t &pos, const uint8_t verbose_level=0);
+      static void fast_mesh_finish();
+    #endif
+
   #else
 
     static constexpr xyz_pos_t offset = xyz_pos_t({ 0, 0, 0 }); // See #16767
@@ -217,6 +223,32 @@ public:
   #endif
 
 private:
+  #if ENABLED(FAST_MESH_PROBING)
+    static struct fast_mesh_t {
+      float last_z;                         // Nozzle Z at the last touch, NAN if unknown
+      float bias_sum, bias_min, bias_max;   // Fast touch minus slow touch
+      uint8_t checks;
+      bool reuse;                           // Fast touch alone is good enough
+      uint16_t points, reused;
+      millis_t start_ms, travel_ms, probe_ms;
+    } fast_mesh;
+  #endif
+
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE) && NONE(IS_SCARA, DELTA)
+    static float trigger_z;                 // Z at the probe's trigger edge
+  #endif
+
+  // Z where the last probe_down_to_z triggered
+  static inline float triggered_z() {
+    return
+      #if ENABLED(ENDSTOP_EDGE_CAPTURE) && NONE(IS_SCARA, DELTA)
+        trigger_z
+      #else
+        current_position.z
+      #endif
+    ;
+  }
+
   static bool probe_down_to_z(const float z, const feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
@@ -388,6 +388,9 @@ typedef struct SettingsDataStruct {
   // LIN_ADVANCE
   //
   float planner_extruder_advance_K[_MAX(EXTRUDERS, 1)]; // M900 K  planner.extruder_advance_K
+  #if BOTH(LIN_ADVANCE, MIXING_EXTRUDER)
+    float planner_mixing_advance_K;                     // M900 B  planner.mixing_advance_K
+  #endif
 
   //
   // HAS_MOTOR_CURRENT_PWM
@@ -1346,6 +1349,11 @@ void MarlinSettings::postprocess() {
         dummyf = 0;
         for (uint8_t q = _MAX(EXTRUDERS, 1); q--;) EEPROM_WRITE(dummyf);
       #endif
+
+      #if BOTH(LIN_ADVANCE, MIXING_EXTRUDER)
+        _FIELD_TEST(planner_mixing_advance_K);
+        EEPROM_WRITE(planner.mixing_advance_K);
+      #endif
     }
 
     //
@@ -2227,6 +2235,11 @@ void MarlinSettings::postprocess() {
           if (!validating)
             COPY(planner.extruder_advance_K, extruder_advance_K);
         #endif
+
+        #if BOTH(LIN_ADVANCE, MIXING_EXTRUDER)
+          _FIELD_TEST(planner_mixing_advance_K);
+          EEPROM_READ(planner.mixing_advance_K);
+        #endif
       }
 
       //
@@ -2927,6 +2940,7 @@ void MarlinSettings::reset() {
       planner.extruder_advance_K[i] = LIN_ADVANCE_K;
       TERN_(EXTRA_LIN_ADVANCE_K, other_extruder_advance_K[i] = LIN_ADVANCE_K);
     }
+    TERN_(MIXING_EXTRUDER, planner.mixing_advance_K = MIXING_ADVANCE_K);
   #endif
 
   //
@@ -3847,6 +3861,10 @@ void MarlinSettings::reset() {
           SERIAL_ECHOLNPAIR("  M900 T", int(i), " K", planner.extruder_advance_K[i]);
         }
       #endif
+      #if ENABLED(MIXING_EXTRUDER)
+        CONFIG_ECHO_START();
+        SERIAL_ECHOLNPAIR("  M900 B", planner.mixing_advance_K);
+      #endif
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
@@ -237,6 +237,15 @@ int32_t Stepper::ticks_nominal = -1;
 #endif
 
 xyz_long_t Stepper::endstops_trigsteps;
+#if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+  uint8_t Stepper::z_sync_hit; // = 0
+  uint8_t Stepper::z_sync_count[2];
+  int32_t Stepper::z_sync_trig[2];
+#endif
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+  xyze_long_t Stepper::edge_position;
+  bool Stepper::edge_latched; // = false
+#endif
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
 
@@ -280,6 +289,18 @@ xyze_int8_t Stepper::count_direction{0};
     A##2_STEP_WRITE(V);                           \
   }
 
+// Each motor stops at the step where its own endstop fires
+#define DUAL_SYNC_APPLY_STEP(A,V)                                       \
+  if (separate_multi_axis) {                                            \
+    z_sync_sample();                                                    \
+    if (!z_sync_blocked(0) && !locked_##A##_motor) A##_STEP_WRITE(V);   \
+    if (!z_sync_blocked(1) && !locked_##A##2_motor) A##2_STEP_WRITE(V); \
+  }                                                                     \
+  else {                                                                \
+    A##_STEP_WRITE(V);                                                  \
+    A##2_STEP_WRITE(V);                                                 \
+  }
+
 #define TRIPLE_ENDSTOP_APPLY_STEP(A,V)                                                                                      \
   if (separate_multi_axis) {                                                                                                \
     if (A##_HOME_DIR < 0) {                                                                                                 \
@@ -400,7 +421,9 @@ xyze_int8_t Stepper::count_direction{0};
   #endif
 #elif NUM_Z_STEPPER_DRIVERS == 2
   #define Z_APPLY_DIR(v,Q) do{ Z_DIR_WRITE(v); Z2_DIR_WRITE(v); }while(0)
-  #if ENABLED(Z_MULTI_ENDSTOPS)
+  #if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+    #define Z_APPLY_STEP(v,Q) DUAL_SYNC_APPLY_STEP(Z,v)
+  #elif ENABLED(Z_MULTI_ENDSTOPS)
     #define Z_APPLY_STEP(v,Q) DUAL_ENDSTOP_APPLY_STEP(Z,v)
   #elif ENABLED(Z_STEPPER_AUTO_ALIGN)
     #define Z_APPLY_STEP(v,Q) DUAL_SEPARATE_APPLY_STEP(Z,v)
@@ -2202,6 +2225,8 @@ uint32_t Stepper::block_phase_isr() {
       // done against the endstop. So, check the limits here: If the movement
       // is against the limits, the block will be marked as to be killed, and
       // on the next call to this ISR, will be discarded.
+      TERN_(ENDSTOP_EDGE_CAPTURE, edge_latched = false);
+      TERN_(Z_MULTI_HOMING_ISR_STOP, z_sync_reset());
       endstops.update();
 
       #if ENABLED(Z_LATE_ENABLE)
@@ -2275,8 +2300,7 @@ uint32_t Stepper::block_phase_isr() {
     DIR_WAIT_BEFORE();
 
     #if ENABLED(MIXING_EXTRUDER)
-      // We don't know which steppers will be stepped because LA loop follows,
-      // with potentially multiple steps. Set all.
+      // Several steppers may be stepped in the LA loop that follows. Set all.
       if (LA_steps > 0)
         MIXER_STEPPER_LOOP(j) NORM_E_DIR(j);
       else if (LA_steps < 0)
@@ -2308,7 +2332,10 @@ uint32_t Stepper::block_phase_isr() {
 
       // Set the STEP pulse ON
       #if ENABLED(MIXING_EXTRUDER)
-        E_STEP_WRITE(mixer.get_next_stepper(), !INVERT_E_STEP_PIN);
+        // Pulse several mixing steppers at once, in proportion to the mix
+        const uint8_t mix_mask = mixer.get_next_steppers(LA_steps);
+        if (!mix_mask) { LA_steps = 0; break; }   // No mix. Shouldn't happen.
+        MIXER_STEPPER_LOOP(j) if (TEST(mix_mask, j)) E_STEP_WRITE(j, !INVERT_E_STEP_PIN);
       #else
         E_STEP_WRITE(stepper_extruder, !INVERT_E_STEP_PIN);
       #endif
@@ -2318,7 +2345,9 @@ uint32_t Stepper::block_phase_isr() {
         START_HIGH_PULSE();
       #endif
 
-      LA_steps < 0 ? ++LA_steps : --LA_steps;
+      #if DISABLED(MIXING_EXTRUDER)
+        LA_steps < 0 ? ++LA_steps : --LA_steps;
+      #endif
 
       #if ISR_PULSE_CONTROL
         AWAIT_HIGH_PULSE();
@@ -2326,7 +2355,7 @@ uint32_t Stepper::block_phase_isr() {
 
       // Set the STEP pulse OFF
       #if ENABLED(MIXING_EXTRUDER)
-        E_STEP_WRITE(mixer.get_stepper(), INVERT_E_STEP_PIN);
+        MIXER_STEPPER_LOOP(j) if (TEST(mix_mask, j)) E_STEP_WRITE(j, INVERT_E_STEP_PIN);
       #else
         E_STEP_WRITE(stepper_extruder, INVERT_E_STEP_PIN);
       #endif
@@ -2696,23 +2725,35 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
 // Stepper ISR (this CAN happen with the endstop limits ISR) then
 // when the stepper ISR resumes, we must be very sure that the movement
 // is properly canceled
-void Stepper::endstop_triggered(const AxisEnum axis) {
-
-  const bool was_enabled = suspend();
-  endstops_trigsteps[axis] = (
+// Axis position in steps from the motor step counts
+static int32_t axis_steps(const xyze_long_t &pos, const AxisEnum axis) {
+  return (
     #if IS_CORE
       (axis == CORE_AXIS_2
-        ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-        : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+        ? CORESIGN(pos[CORE_AXIS_1] - pos[CORE_AXIS_2])
+        : pos[CORE_AXIS_1] + pos[CORE_AXIS_2]
       ) * double(0.5)
     #elif ENABLED(MARKFORGED_XY)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2]
-        : count_position[CORE_AXIS_2]
+        ? pos[CORE_AXIS_1] - pos[CORE_AXIS_2]
+        : pos[CORE_AXIS_2]
     #else // !IS_CORE
-      count_position[axis]
+      pos[axis]
     #endif
   );
+}
+
+void Stepper::endstop_triggered(const AxisEnum axis) {
+
+  const bool was_enabled = suspend();
+
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+    // Use the counts from the edge, not from the (filtered, polled) detection
+    endstops_trigsteps[axis] = axis_steps(edge_latched ? edge_position : count_position, axis);
+    edge_latched = false;
+  #else
+    endstops_trigsteps[axis] = axis_steps(count_position, axis);
+  #endif
 
   // Discard the rest of the move if there is a current block
   quick_stop();
@@ -2737,6 +2778,28 @@ int32_t Stepper::triggered_position(const AxisEnum axis) {
   return v;
 }
 
+#if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+
+  // Called from the endstops update. The stepper ISR has done the latching.
+  bool Stepper::z_sync_stopped() {
+    if (!z_sync_blocked(0) || !z_sync_blocked(1)) return false;
+    TERN_(ENDSTOP_EDGE_CAPTURE, edge_latched = false); // Neither motor ran past its edge
+    return true;
+  }
+
+#endif
+
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+
+  int32_t Stepper::trigger_overrun(const AxisEnum axis) {
+    const bool was_enabled = suspend();
+    const int32_t v = axis_steps(count_position, axis) - endstops_trigsteps[axis];
+    if (was_enabled) wake_up();
+    return v;
+  }
+
+#endif
+
 void Stepper::report_a_position(const xyz_long_t &pos) {
   #if ANY(CORE_IS_XY, CORE_IS_XZ, MARKFORGED_XY, DELTA, IS_SCARA)
     SERIAL_ECHOPAIR(STR_COUNT_A, pos.x, " B:", pos.y);
@@ -292,6 +292,42 @@ class Stepper {
                   ;
     #endif
 
+    #if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+      #ifdef ENDSTOP_NOISE_THRESHOLD
+        #define Z_SYNC_SAMPLES ENDSTOP_NOISE_THRESHOLD
+      #else
+        #define Z_SYNC_SAMPLES 1
+      #endif
+      static uint8_t z_sync_hit;            // Z motors whose endstop has fired
+      static uint8_t z_sync_count[2];       // Steps in a row each Z endstop has read triggered
+      static int32_t z_sync_trig[2];        // Z step count at each endstop edge
+      FORCE_INLINE static bool z_sync_blocked(const uint8_t m) { return TEST(z_sync_hit, m); }
+      FORCE_INLINE static void z_sync_reset() { z_sync_hit = 0; z_sync_count[0] = z_sync_count[1] = 0; }
+
+      // Read the Z endstop pins at each step towards home, so each motor
+      // stops right at its own endstop, not at the next poll. A motor stops
+      // only after Z_SYNC_SAMPLES triggered reads in a row, so a glitch on
+      // the line doesn't stop it.
+      FORCE_INLINE static void z_sync_sample() {
+        if (count_direction.z != (Z_HOME_DIR)) return;
+        #if Z_HOME_DIR < 0
+          #define _Z_SYNC_HIT(P) (READ(P##_MIN_PIN) != P##_MIN_ENDSTOP_INVERTING)
+        #else
+          #define _Z_SYNC_HIT(P) (READ(P##_MAX_PIN) != P##_MAX_ENDSTOP_INVERTING)
+        #endif
+        #define _Z_SYNC_SAMPLE(M,P) do{ \
+          if (TEST(z_sync_hit, M)) break; \
+          if (!_Z_SYNC_HIT(P)) { z_sync_count[M] = 0; break; } \
+          if (!z_sync_count[M]) z_sync_trig[M] = count_position.z; \
+          if (++z_sync_count[M] >= Z_SYNC_SAMPLES) SBI(z_sync_hit, M); \
+        }while(0)
+        _Z_SYNC_SAMPLE(0, Z);
+        _Z_SYNC_SAMPLE(1, Z2);
+        #undef _Z_SYNC_SAMPLE
+        #undef _Z_SYNC_HIT
+      }
+    #endif
+
     static uint32_t acceleration_time, deceleration_time; // time measured in Stepper Timer ticks
     static uint8_t steps_per_isr;         // Count of steps to perform per Stepper ISR call
 
@@ -353,6 +389,11 @@ class Stepper {
     // Exact steps at which an endstop was triggered
     static xyz_long_t endstops_trigsteps;
 
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      static xyze_long_t edge_position;     // Step counts at the last endstop edge
+      static bool edge_latched;             // Edge seen during the current block
+    #endif
+
     // Positions of stepper motors, in step units
     static xyze_long_t count_position;
 
@@ -463,6 +504,19 @@ class Stepper {
     // Triggered position of an axis in steps
     static int32_t triggered_position(const AxisEnum axis);
 
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      // Latch the step counts at an endstop edge. Called from ISR contexts.
+      FORCE_INLINE static void latch_edge_position() {
+        CRITICAL_SECTION_START();
+        edge_position = count_position;
+        edge_latched = true;
+        CRITICAL_SECTION_END();
+      }
+
+      // Steps run past the trigger edge before the stop
+      static int32_t trigger_overrun(const AxisEnum axis);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void set_digipot_value_spi(const int16_t address, const int16_t value);
       static void set_digipot_current(const uint8_t driver, const int16_t current);
@@ -505,6 +559,14 @@ class Stepper {
         #endif
       }
     #endif
+    #if ENABLED(Z_MULTI_HOMING_ISR_STOP)
+      // True once both Z motors have stopped at their endstops
+      static bool z_sync_stopped();
+      // Steps Z2's endstop fired after Z1's on the last pass
+      FORCE_INLINE static int32_t z_sync_skew() { return (z_sync_trig[1] - z_sync_trig[0]) * (Z_HOME_DIR); }
+      // Steps each Z motor ran past its edge before the reads confirmed it
+      static constexpr int32_t z_sync_overrun() { return (Z_SYNC_SAMPLES - 1) * (Z_HOME_DIR); }
+    #endif
 
     #if ENABLED(BABYSTEPPING)
       static void do_babystep(const AxisEnum axis, const bool direction); // perform a short step with a single stepper motor, outside of any convention
@@ -103,6 +103,10 @@
   #include "../feature/joystick.h"
 #endif
 
+#if ENABLED(PREHEAT_SCHEDULER)
+  #include "../feature/preheat_scheduler.h"
+#endif
+
 #if ENABLED(SINGLENOZZLE)
   #include "tool_change.h"
 #endif
@@ -2119,6 +2123,9 @@ void Temperature::disable_all_heaters() {
   // Unpause and reset everything
   TERN_(PROBING_HEATERS_OFF, pause(false));
 
+  // Forget any deferred heater waits
+  TERN_(PREHEAT_SCHEDULER, preheat.reset());
+
   #if HAS_HOTEND
     HOTEND_LOOP() {
       setTargetHotend(0, e);
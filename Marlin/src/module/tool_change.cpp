@@ -861,6 +861,8 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 	    mixer.T(new_tool);
     #endif
 
+    TERN_(HOTEND_CLEAN_TOWER, if (!no_move) mixer.build_clean_tower());
+
   #elif ENABLED(PRUSA_MMU2)
 
     UNUSED(no_move);
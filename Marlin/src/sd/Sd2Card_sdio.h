@@ -29,11 +29,31 @@ bool SDIO_Init();
 bool SDIO_ReadBlock(uint32_t block, uint8_t *dst);
 bool SDIO_WriteBlock(uint32_t block, const uint8_t *src);
 
+#ifdef ARDUINO_ARCH_STM32F1
+  bool SDIO_Begin();
+  bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, uint32_t count);
+  bool SDIO_WriteBlocks(uint32_t block, const uint8_t *src, uint32_t count);
+#else
+  inline bool SDIO_Begin() { return SDIO_Init(); }
+
+  // No multi-block transfer in this HAL, so go one block at a time
+  inline bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, uint32_t count) {
+    for (; count; count--, dst += 512) if (!SDIO_ReadBlock(block++, dst)) return false;
+    return true;
+  }
+  inline bool SDIO_WriteBlocks(uint32_t block, const uint8_t *src, uint32_t count) {
+    for (; count; count--, src += 512) if (!SDIO_WriteBlock(block++, src)) return false;
+    return true;
+  }
+#endif
+
 class Sd2Card {
   public:
-    bool init(uint8_t sckRateID = 0, uint8_t chipSelectPin = 0) { return SDIO_Init(); }
+    bool init(uint8_t sckRateID = 0, uint8_t chipSelectPin = 0) { return SDIO_Begin(); }
     bool readBlock(uint32_t block, uint8_t *dst) { return SDIO_ReadBlock(block, dst); }
     bool writeBlock(uint32_t block, const uint8_t *src) { return SDIO_WriteBlock(block, src); }
+    bool readBlocks(uint32_t block, uint8_t *dst, uint32_t count) { return SDIO_ReadBlocks(block, dst, count); }
+    bool writeBlocks(uint32_t block, const uint8_t *src, uint32_t count) { return SDIO_WriteBlocks(block, src, count); }
 };
 
 #endif // SDIO_SUPPORT
@@ -1716,6 +1716,21 @@ int16_t SdBaseFile::write(const void* buf, uint16_t nbyte) {
 
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+    #if ENABLED(SD_UPLOAD_STREAM)
+      // whole blocks to the end of the cluster in one multi-block write
+      const uint8_t count = blockOffset ? 0 : _MIN(nToWrite >> 9, vol_->blocksPerCluster() - blockOfCluster);
+      if (count > 1) {
+        const uint32_t cached = vol_->cacheBlockNumber();
+        if (cached >= block && cached < block + count) {
+          // invalidate cache if block is in cache
+          vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
+        }
+        if (!vol_->writeBlocks(block, src, count)) goto FAIL;
+        n = uint16_t(count) << 9;
+      }
+      else
+    #endif
     if (n == 512) {
       // full block - don't need to use cache
       if (vol_->cacheBlockNumber() == block) {
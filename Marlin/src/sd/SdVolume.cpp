@@ -121,11 +121,13 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
 bool SdVolume::cacheFlush() {
   #if DISABLED(SDCARD_READONLY)
     if (cacheDirty_) {
+      dropHostCopy(cacheBlockNumber_, 1);
       if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data))
         return false;
 
       // mirror FAT tables
       if (cacheMirrorBlock_) {
+        dropHostCopy(cacheMirrorBlock_, 1);
         if (!sdCard_->writeBlock(cacheMirrorBlock_, cacheBuffer_.data))
           return false;
         cacheMirrorBlock_ = 0;
@@ -146,6 +148,21 @@ bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   return true;
 }
 
+#if ENABLED(SD_UPLOAD_STREAM)
+  // Write consecutive blocks with one multi-block write, pre-erased by the card
+  bool SdVolume::writeBlocks(uint32_t block, const uint8_t* src, const uint8_t count) {
+    dropHostCopy(block, count);
+    #if ENABLED(SDIO_SUPPORT)
+      return sdCard_->writeBlocks(block, src, count);
+    #else
+      if (!sdCard_->writeStart(block, count)) return false;
+      bool ok = true;
+      for (uint8_t i = 0; ok && i < count; i++, src += 512) ok = sdCard_->writeData(src);
+      return sdCard_->writeStop() && ok;
+    #endif
+  }
+#endif
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t* size) {
   uint32_t s = 0;
@@ -48,6 +48,10 @@
 #include "SdFatConfig.h"
 #include "SdFatStructs.h"
 
+#ifdef USB_MSC_CACHE_SECTORS
+  void MSC_SD_invalidate(const uint32_t startSector, const uint32_t numSectors);
+#endif
+
 //==============================================================================
 // SdVolume class
 /**
@@ -197,5 +201,17 @@ class SdVolume {
     return  cluster >= FAT32EOC_MIN;
   }
   bool readBlock(uint32_t block, uint8_t* dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(uint32_t block, const uint8_t* dst) { return sdCard_->writeBlock(block, dst); }
+  bool writeBlock(uint32_t block, const uint8_t* dst) { dropHostCopy(block, 1); return sdCard_->writeBlock(block, dst); }
+  #if ENABLED(SD_UPLOAD_STREAM)
+    bool writeBlocks(uint32_t block, const uint8_t* src, const uint8_t count);
+  #endif
+
+  // The USB host's sector cache must not keep a copy of a block written here
+  static inline void dropHostCopy(const uint32_t block, const uint32_t count) {
+    #ifdef USB_MSC_CACHE_SECTORS
+      MSC_SD_invalidate(block, count);
+    #else
+      UNUSED(block); UNUSED(count);
+    #endif
+  }
 };
@@ -41,6 +41,10 @@
 #include "../module/settings.h"
 #include "../module/stepper/indirection.h"
 
+#if ENABLED(PREHEAT_SCHEDULER_AUTO)
+  #include "../feature/preheat_scheduler.h"
+#endif
+
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
 #endif
@@ -53,6 +57,18 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING_SD)
+  #include "../feature/sd_step_job.h"
+#endif
+
+#if ENABLED(ADAPTIVE_MESH_PROBING)
+  #include "../libs/gcode_scanner.h"
+#endif
+
+#if ENABLED(JOB_ANALYZER)
+  #include "../feature/job_analyzer.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -69,12 +85,22 @@ int8_t CardReader::autostart_index;
 
 // private:
 
+#if ENABLED(SD_UPLOAD_STREAM)
+  uint8_t CardReader::upload_buf[SD_UPLOAD_BLOCKS * 512];
+  uint16_t CardReader::upload_len;
+  uint32_t CardReader::upload_bytes;
+  millis_t CardReader::upload_start_ms;
+#endif
+
 SdFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
 uint8_t CardReader::workDirDepth;
 
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   uint16_t CardReader::sort_count;
+  #if ENABLED(SD_BACKGROUND_SCAN)
+    bool CardReader::sort_pending;
+  #endif
   #if ENABLED(SDSORT_GCODE)
     bool CardReader::sort_alpha;
     int CardReader::sort_folders;
@@ -124,6 +150,15 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_BACKGROUND_SCAN)
+  CardReader::MediaState CardReader::media_state; // = MEDIA_IDLE
+  uint8_t CardReader::mount_old_stat;
+  millis_t CardReader::media_next_ms;
+  SdFile CardReader::scanDir;
+  uint16_t CardReader::scan_count;
+  bool CardReader::scan_valid;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -371,7 +406,10 @@ void CardReader::printFilename() {
   SERIAL_EOL();
 }
 
-void CardReader::mount() {
+//
+// Mount in three steps, which SD_BACKGROUND_SCAN runs on separate calls
+//
+bool CardReader::initCard() {
   flag.mounted = false;
   if (root.isOpen()) root.close();
 
@@ -379,8 +417,15 @@ void CardReader::mount() {
     #if defined(LCD_SDSS) && (LCD_SDSS != SDSS)
       && !sd2card.init(SPI_SPEED, LCD_SDSS)
     #endif
-  ) SERIAL_ECHO_MSG(STR_SD_INIT_FAIL);
-  else if (!volume.init(&sd2card))
+  ) {
+    SERIAL_ECHO_MSG(STR_SD_INIT_FAIL);
+    return false;
+  }
+  return true;
+}
+
+bool CardReader::openVolume() {
+  if (!volume.init(&sd2card))
     SERIAL_ERROR_MSG(STR_SD_VOL_INIT_FAIL);
   else if (!root.openRoot(&volume))
     SERIAL_ERROR_MSG(STR_SD_OPENROOT_FAIL);
@@ -388,7 +433,16 @@ void CardReader::mount() {
     flag.mounted = true;
     SERIAL_ECHO_MSG(STR_SD_CARD_OK);
   }
+  return flag.mounted;
+}
 
+void CardReader::mount() {
+  TERN_(SD_BACKGROUND_SCAN, media_state = MEDIA_IDLE);
+  if (initCard()) openVolume();
+  finishMount();
+}
+
+void CardReader::finishMount() {
   if (flag.mounted)
     cdroot();
   #if ENABLED(USB_FLASH_DRIVE_SUPPORT) || PIN_EXISTS(SD_DETECT)
@@ -407,6 +461,8 @@ void CardReader::mount() {
 #endif
 
 void CardReader::manage_media() {
+  TERN_(SD_BACKGROUND_SCAN, if (media_state) mediaTask());
+
   static uint8_t prev_stat = 2;       // First call, no prior state
   uint8_t stat = uint8_t(IS_SD_INSERTED());
   if (stat == prev_stat) return;
@@ -421,12 +477,18 @@ void CardReader::manage_media() {
     prev_stat = stat;                 // Change now to prevent re-entry
 
     if (stat) {                       // Media Inserted
-      safe_delay(500);                // Some boards need a delay to get settled
-      mount();                        // Try to mount the media
-      #if MB(FYSETC_CHEETAH, FYSETC_CHEETAH_V12, FYSETC_AIO_II)
-        reset_stepper_drivers();      // Workaround for Cheetah bug
+      // Some boards need a delay to get settled. A card present at boot has had time already.
+      const millis_t settle_ms = TERN1(DEFERRED_BOOT, old_stat != 2) ? 500 : 0;
+      #if ENABLED(SD_BACKGROUND_SCAN)
+        // Settle and mount on the next calls, then finish in mediaChanged()
+        mount_old_stat = old_stat;
+        media_next_ms = millis() + settle_ms;
+        media_state = MEDIA_SETTLE;
+        return;
+      #else
+        if (settle_ms) safe_delay(settle_ms);
+        mount();                      // Try to mount the media
       #endif
-      if (!isMounted()) stat = 0;     // Not mounted?
     }
     else {
       #if PIN_EXISTS(SD_DETECT)
@@ -434,26 +496,114 @@ void CardReader::manage_media() {
       #endif
     }
 
-    ui.media_changed(old_stat, stat); // Update the UI
-
-    if (stat) {
-      TERN_(SDCARD_EEPROM_EMULATION, settings.first_load());
-      if (old_stat == 2)              // First mount?
-        DEBUG_ECHOLNPGM("First mount.");
-        TERN(POWER_LOSS_RECOVERY,
-          recovery.check(),           // Check for PLR file. (If not there it will beginautostart)
-          beginautostart()            // Look for auto0.g on the next loop
-        );
-    }
+    mediaChanged(old_stat, stat);
   }
   else
     DEBUG_ECHOLNPGM("SD: No UI Detected.");
 }
 
+void CardReader::mediaChanged(const uint8_t old_stat, uint8_t stat) {
+  if (stat) {
+    #if MB(FYSETC_CHEETAH, FYSETC_CHEETAH_V12, FYSETC_AIO_II)
+      reset_stepper_drivers();        // Workaround for Cheetah bug
+    #endif
+    if (!isMounted()) stat = 0;       // Not mounted?
+  }
+
+  ui.media_changed(old_stat, stat);   // Update the UI
+
+  if (stat) {
+    TERN_(SDCARD_EEPROM_EMULATION, settings.first_load());
+    if (old_stat == 2)                // First mount?
+      DEBUG_ECHOLNPGM("First mount.");
+      TERN(POWER_LOSS_RECOVERY,
+        recovery.check(),             // Check for PLR file. (If not there it will beginautostart)
+        beginautostart()              // Look for auto0.g on the next loop
+      );
+  }
+}
+
+#if ENABLED(SD_BACKGROUND_SCAN)
+
+  /**
+   * Step the media state machine. Each step is one call from idle():
+   *  - SETTLE: Wait for the card to settle, then init the card.
+   *  - VOLUME: Open the volume and root, then tell the UI.
+   *  - COUNT:  Count the work dir items for SD_SCAN_SLICE_MS.
+   * Sd2Card::init() and SdVolume::init() still block for one step each.
+   */
+  void CardReader::mediaTask() {
+    switch (media_state) {
+      case MEDIA_SETTLE:
+        if (PENDING(millis(), media_next_ms)) break;
+        if (initCard()) { media_state = MEDIA_VOLUME; break; }
+        media_state = MEDIA_IDLE;
+        finishMount();
+        mediaChanged(mount_old_stat, 1);
+        break;
+
+      case MEDIA_VOLUME:
+        media_state = MEDIA_IDLE;
+        openVolume();
+        finishMount();                // Starts the count when mounted
+        mediaChanged(mount_old_stat, 1);
+        break;
+
+      case MEDIA_COUNT:
+        if (scanStep()) media_state = MEDIA_IDLE;
+        break;
+
+      default: break;
+    }
+  }
+
+  // Count the work dir again, starting on the next idle()
+  void CardReader::startScan() {
+    scan_count = 0;
+    scan_valid = false;
+    if (!isMounted()) return;
+    scanDir = workDir;
+    scanDir.rewind();
+    media_state = MEDIA_COUNT;
+  }
+
+  // Count work dir items for up to SD_SCAN_SLICE_MS. Return true when done.
+  bool CardReader::scanStep() {
+    const bool was_dir = flag.filenameIsDir;  // The selected item's flag
+    const millis_t end_ms = millis() + SD_SCAN_SLICE_MS;
+    dir_t p;
+    do {
+      if (scanDir.readDir(&p, nullptr) <= 0) { // No long name, so longFilename is kept
+        scan_valid = true;
+        break;
+      }
+      scan_count += is_dir_or_gcode(p);
+    } while (PENDING(millis(), end_ms));
+    flag.filenameIsDir = was_dir;
+    return scan_valid;
+  }
+
+  // The work dir count, finishing the scan now if needed
+  uint16_t CardReader::filesInWorkDir() {
+    if (!isMounted()) return 0;
+    if (!scan_valid) {
+      if (media_state != MEDIA_COUNT) startScan();
+      while (!scanStep()) { /* nada */ }
+      media_state = MEDIA_IDLE;
+    }
+    return scan_count;
+  }
+
+#endif // SD_BACKGROUND_SCAN
+
 void CardReader::release() {
   endFilePrint();
   flag.mounted = false;
   flag.workDirIsRoot = true;
+  #if ENABLED(SD_BACKGROUND_SCAN)
+    media_state = MEDIA_IDLE;
+    scan_valid = false;
+  #endif
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
     nrFiles = 0;
   #endif
@@ -472,6 +622,11 @@ void CardReader::startFileprint() {
   if (isMounted()) {
     flag.sdprinting = true;
     TERN_(SD_RESORT, flush_presort());
+    // A job starting from the top may overlap its heat-up with homing and probing
+    TERN_(PREHEAT_SCHEDULER_AUTO, if (!sdpos) preheat.enable(true));
+    #if ENABLED(JOB_ANALYZER)
+      if (!sdpos && job_analyzer.matchesPrint()) job_analyzer.report();
+    #endif
   }
 }
 
@@ -586,6 +741,11 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
 
     selectFileByName(fname);
     ui.set_status(longFilename[0] ? longFilename : fname);
+
+    // A step job takes over the file from the G-code reader
+    #if ENABLED(DIRECT_STEPPING_SD)
+      if (subcall_type != 2) sd_step_job.open();
+    #endif
   }
   else
     openFailed(fname);
@@ -615,7 +775,13 @@ void CardReader::openFileWrite(char * const path) {
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      #if ENABLED(SD_UPLOAD_STREAM)
+        upload_len = 0;
+        upload_bytes = 0;
+        upload_start_ms = millis();
+      #endif
       selectFileByName(fname);
+      TERN_(SD_BACKGROUND_SCAN, startScan()); // A new item may be in the work dir
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
       ui.set_status(fname);
@@ -659,7 +825,7 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(curDir, fname)) {
       SERIAL_ECHOLNPAIR("File deleted:", fname);
       sdpos = 0;
-      TERN_(SDCARD_SORT_ALPHA, presort());
+      workDirChanged();
     }
     else
       SERIAL_ECHOLNPAIR("Deletion failed, File: ", fname, ".");
@@ -690,7 +856,7 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+  TERN(SD_UPLOAD_STREAM, upload_write(begin, end + 3 - begin), file.write(begin));
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
@@ -732,7 +898,49 @@ void CardReader::beginautostart() {
   cdroot();
 }
 
+#if ENABLED(SD_UPLOAD_STREAM)
+
+  /**
+   * Stage writes so the card gets whole, block-aligned runs. SdBaseFile
+   * writes each run to the end of a cluster with one pre-erased
+   * multi-block write instead of a block at a time through the cache.
+   */
+  int16_t CardReader::upload_write(const void *buf, const uint16_t nbyte) {
+    const uint8_t *src = (const uint8_t*)buf;
+    uint16_t left = nbyte;
+    while (left) {
+      const uint16_t n = _MIN(left, uint16_t(sizeof(upload_buf) - upload_len));
+      memcpy(upload_buf + upload_len, src, n);
+      upload_len += n;
+      src += n;
+      left -= n;
+      if (upload_len == sizeof(upload_buf) && !upload_flush()) return -1;
+    }
+    upload_bytes += nbyte;
+    return nbyte;
+  }
+
+  bool CardReader::upload_flush() {
+    if (!upload_len) return true;
+    const bool ok = file.write(upload_buf, upload_len) == int16_t(upload_len);
+    upload_len = 0;
+    return ok;
+  }
+
+  uint32_t CardReader::upload_rate() {
+    const millis_t ms = millis() - upload_start_ms;
+    return ms ? upload_bytes * 1000ULL / ms : 0;
+  }
+
+#endif
+
 void CardReader::closefile(const bool store_location/*=false*/) {
+  #if ENABLED(SD_UPLOAD_STREAM)
+    if (flag.saving) {
+      if (!upload_flush()) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+      if (!flag.logging) SERIAL_ECHOLNPAIR("Upload ", upload_bytes, " bytes at ", upload_rate(), " B/s");
+    }
+  #endif
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
@@ -871,7 +1079,7 @@ const char* CardReader::diveToFile(const bool update_cwd, SdFile*& diveDir, cons
     workDir = *diveDir;
     DEBUG_ECHOLNPAIR("diveToFile: final workDir = ", hex_address((void*)diveDir));
     flag.workDirIsRoot = (workDirDepth == 0);
-    TERN_(SDCARD_SORT_ALPHA, presort());
+    workDirChanged();
   }
 
   return item_name_adr;
@@ -886,7 +1094,7 @@ void CardReader::cd(const char * relpath) {
     flag.workDirIsRoot = false;
     if (workDirDepth < MAX_DIR_DEPTH)
       workDirParents[workDirDepth++] = workDir;
-    TERN_(SDCARD_SORT_ALPHA, presort());
+    workDirChanged();
   }
   else {
     SERIAL_ECHO_START();
@@ -897,7 +1105,7 @@ void CardReader::cd(const char * relpath) {
 int8_t CardReader::cdup() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
-    TERN_(SDCARD_SORT_ALPHA, presort());
+    workDirChanged();
   }
   if (!workDirDepth) flag.workDirIsRoot = true;
   return workDirDepth;
@@ -906,7 +1114,13 @@ int8_t CardReader::cdup() {
 void CardReader::cdroot() {
   workDir = root;
   flag.workDirIsRoot = true;
+  workDirChanged();
+}
+
+// Sort and count the new work dir, or the old one after a change
+void CardReader::workDirChanged() {
   TERN_(SDCARD_SORT_ALPHA, presort());
+  TERN_(SD_BACKGROUND_SCAN, startScan());
 }
 
 #if ENABLED(SDCARD_SORT_ALPHA)
@@ -915,6 +1129,7 @@ void CardReader::cdroot() {
    * Get the name of a file in the working directory by sort-index
    */
   void CardReader::getfilename_sorted(const uint16_t nr) {
+    TERN_(SD_BACKGROUND_SCAN, if (sort_pending) presort(true));
     selectFileByIndex(TERN1(SDSORT_GCODE, sort_alpha) && (nr < sort_count)
       ? sort_order[nr] : nr);
   }
@@ -956,7 +1171,7 @@ void CardReader::cdroot() {
    *  - Some RAM: Buffer the directory just for this sort
    *  - Most RAM: Buffer the directory and return filenames from RAM
    */
-  void CardReader::presort() {
+  void CardReader::presort(TERN_(SD_BACKGROUND_SCAN, const bool now/*=false*/)) {
 
     // Throw away old sort index
     flush_presort();
@@ -964,8 +1179,13 @@ void CardReader::cdroot() {
     // Sorting may be turned off
     if (TERN0(SDSORT_GCODE, !sort_alpha)) return;
 
+    // Sort when a sorted name is first needed, not on every folder change
+    #if ENABLED(SD_BACKGROUND_SCAN)
+      if (!now) { sort_pending = true; return; }
+    #endif
+
     // If there are files, sort up to the limit
-    uint16_t fileCnt = countFilesInWorkDir();
+    uint16_t fileCnt = TERN(SD_BACKGROUND_SCAN, filesInWorkDir(), countFilesInWorkDir());
     if (fileCnt > 0) {
 
       // Never sort more than the max allowed
@@ -1122,6 +1342,7 @@ void CardReader::cdroot() {
   }
 
   void CardReader::flush_presort() {
+    TERN_(SD_BACKGROUND_SCAN, sort_pending = false);
     if (sort_count > 0) {
       #if ENABLED(SDSORT_DYNAMIC_RAM)
         delete sort_order;
@@ -1145,6 +1366,8 @@ uint16_t CardReader::get_num_Files() {
   return (
     #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
       nrFiles // no need to access the SD card for filenames
+    #elif ENABLED(SD_BACKGROUND_SCAN)
+      filesInWorkDir() // counted in the background
     #else
       countFilesInWorkDir()
     #endif
@@ -1187,6 +1410,114 @@ void CardReader::fileHasFinished() {
   }
 #endif // AUTO_REPORT_SD_STATUS
 
+#if ENABLED(ADAPTIVE_MESH_PROBING)
+
+  /**
+   * Find the XY extent of all extrusion in the open file.
+   * Slicer header bounds (;MINX: ;MINY: ;MAXX: ;MAXY:) are used when
+   * all four are present. Otherwise extruding moves are tracked from the
+   * first layer comment (;LAYER... or ; layer...) on, leaving out a purge
+   * line in the start G-code. Files with no layer comments use every
+   * extruding move. The file position is restored.
+   *
+   * idle() runs between reads to keep heaters and the host alive. The scan
+   * gives up after ADAPTIVE_MESH_SCAN_TIME, so a huge file falls back to
+   * the full grid instead of holding up G29.
+   */
+  bool CardReader::scanPrintArea(xy_pos_t &min, xy_pos_t &max) {
+    if (!isFileOpen()) return false;
+
+    const uint32_t oldpos = file.curPosition();
+    file.seekSet(0);
+
+    GCodeScanner scanner;
+    xy_pos_t hmin = { 0, 0 }, hmax = { 0, 0 };
+    uint8_t hseen = 0;
+
+    // Extents before [0] and after [1] the first layer comment
+    xy_pos_t bmin[2], bmax[2];
+    bool seen[2] = { false, false };
+    uint8_t part = 0;
+    bool done = false;
+
+    char line[MAX_CMD_SIZE];
+    uint8_t len = 0;
+    uint8_t buf[64];
+
+    const millis_t stop_ms = millis() + SEC_TO_MS(ADAPTIVE_MESH_SCAN_TIME);
+    bool timeout = false;
+
+    while (!done) {
+      const int16_t n = file.read(buf, sizeof(buf));
+      if (n <= 0) break;
+      for (int16_t i = 0; i < n && !done; i++) {
+        const char c = buf[i];
+        if (c != '\n' && c != '\r') {
+          if (len < sizeof(line) - 1) line[len++] = c;
+          continue;
+        }
+        if (!len) continue;
+        line[len] = '\0';
+        len = 0;
+
+        switch (scanner.scan(line)) {
+          case GCodeScanner::SCAN_COMMENT: {
+            const char *p = strchr(line, ';') + 1;
+            while (*p == ' ') p++;
+
+            if (!strncmp_P(p, PSTR("LAYER"), 5) || !strncmp_P(p, PSTR("layer"), 5)) {
+              part = 1;
+              break;
+            }
+
+            // Cura-style header bounds
+            if (strlen(p) < 6 || p[4] != ':' || (p[3] != 'X' && p[3] != 'Y')) break;
+            const bool ismax = !strncmp_P(p, PSTR("MAX"), 3);
+            if (!ismax && strncmp_P(p, PSTR("MIN"), 3)) break;
+            const uint8_t axis = p[3] == 'X' ? X_AXIS : Y_AXIS;
+            (ismax ? hmax : hmin)[axis] = strtof(p + 5, nullptr);
+            SBI(hseen, axis + (ismax ? 2 : 0));
+            done = hseen == 0x0F;
+          } break;
+
+          case GCodeScanner::SCAN_EXTRUDE: {
+            xy_pos_t &lo = bmin[part], &hi = bmax[part];
+            if (!seen[part]) {
+              lo = scanner.lo; hi = scanner.hi;
+              seen[part] = true;
+            }
+            NOMORE(lo.x, scanner.lo.x);
+            NOMORE(lo.y, scanner.lo.y);
+            NOLESS(hi.x, scanner.hi.x);
+            NOLESS(hi.y, scanner.hi.y);
+          } break;
+
+          default: break;
+        }
+      }
+      idle();
+      if (ELAPSED(millis(), stop_ms)) { timeout = true; break; }
+    }
+
+    file.seekSet(oldpos);
+    if (timeout) {
+      SERIAL_ECHOLNPGM("Print area scan timed out");
+      return false;
+    }
+
+    if (hseen == 0x0F) {
+      min = hmin; max = hmax;
+      return true;
+    }
+
+    const uint8_t use = seen[1] ? 1 : 0;
+    if (!seen[use]) return false;
+    min = bmin[use]; max = bmax[use];
+    return true;
+  }
+
+#endif // ADAPTIVE_MESH_PROBING
+
 #if ENABLED(POWER_LOSS_RECOVERY)
 
 bool CardReader::jobRecoverFileExists() {
@@ -77,12 +77,19 @@ public:
   CardReader();
 
   static SdFile getroot() { return root; }
+  static SdFile getWorkDir() { return workDir; }
 
   static void mount();
   static void release();
   static inline bool isMounted() { return flag.mounted; }
   static void ls();
 
+  #if ENABLED(SD_BACKGROUND_SCAN)
+    static inline bool isMounting() { return WITHIN(media_state, MEDIA_SETTLE, MEDIA_VOLUME); }
+    static inline bool isScanning() { return media_state == MEDIA_COUNT; }
+    static inline uint16_t filesCounted() { return scan_count; } // So far, while scanning
+  #endif
+
   // Handle media insert/remove
   static void manage_media();
 
@@ -138,7 +145,7 @@ public:
   static const char* diveToFile(const bool update_cwd, SdFile*& curDir, const char * const path, const bool echo=false);
 
   #if ENABLED(SDCARD_SORT_ALPHA)
-    static void presort();
+    static void presort(TERN_(SD_BACKGROUND_SCAN, const bool now=false));
     static void getfilename_sorted(const uint16_t nr);
     #if ENABLED(SDSORT_GCODE)
       FORCE_INLINE static void setSortOn(bool b) { sort_alpha = b; presort(); }
@@ -155,15 +162,26 @@ public:
     static void removeJobRecoveryFile();
   #endif
 
+  #if ENABLED(ADAPTIVE_MESH_PROBING)
+    static bool scanPrintArea(xy_pos_t &min, xy_pos_t &max);
+  #endif
+
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
+  static inline uint32_t getFileCluster() { return file.firstCluster(); }
   static inline bool eof() { return sdpos >= filesize; }
   static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
   static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
   static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? TERN(SD_UPLOAD_STREAM, upload_write, file.write)(buf, nbyte) : -1; }
+
+  #if ENABLED(SD_UPLOAD_STREAM)
+    static int16_t upload_write(const void *buf, const uint16_t nbyte);
+    static bool upload_flush();
+    static uint32_t upload_rate();            // Bytes per second since the file was opened
+  #endif
 
   static Sd2Card& getSd2Card() { return sd2card; }
 
@@ -191,6 +209,9 @@ private:
   //
   #if ENABLED(SDCARD_SORT_ALPHA)
     static uint16_t sort_count;   // Count of sorted items in the current directory
+    #if ENABLED(SD_BACKGROUND_SCAN)
+      static bool sort_pending;   // Sort before the next sorted name is read
+    #endif
     #if ENABLED(SDSORT_GCODE)
       static bool sort_alpha;     // Flag to enable / disable the feature
       static int sort_folders;    // Folder sorting before/none/after
@@ -245,8 +266,32 @@ private:
   static SdVolume volume;
   static SdFile file;
 
+  #if ENABLED(SD_UPLOAD_STREAM)
+    static uint8_t upload_buf[SD_UPLOAD_BLOCKS * 512];
+    static uint16_t upload_len;
+    static uint32_t upload_bytes;
+    static millis_t upload_start_ms;
+  #endif
+
   static uint32_t filesize, sdpos;
 
+  //
+  // Mounting and counting from the idle loop
+  //
+  #if ENABLED(SD_BACKGROUND_SCAN)
+    enum MediaState : uint8_t { MEDIA_IDLE, MEDIA_SETTLE, MEDIA_VOLUME, MEDIA_COUNT };
+    static MediaState media_state;
+    static uint8_t mount_old_stat;  // Media state before the insert being mounted
+    static millis_t media_next_ms;
+    static SdFile scanDir;          // Copy of workDir being counted
+    static uint16_t scan_count;
+    static bool scan_valid;         // scan_count covers all of workDir
+    static void mediaTask();
+    static void startScan();
+    static bool scanStep();
+    static uint16_t filesInWorkDir();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -276,6 +321,15 @@ private:
   static void selectByIndex(SdFile dir, const uint8_t index);
   static void selectByName(SdFile dir, const char * const match);
   static void printListing(SdFile parent, const char * const prepend=nullptr);
+  static void workDirChanged();
+
+  //
+  // Mount steps and media change handling
+  //
+  static bool initCard();
+  static bool openVolume();
+  static void finishMount();
+  static void mediaChanged(const uint8_t old_stat, uint8_t stat);
 
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
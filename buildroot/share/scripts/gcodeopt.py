@@ -0,0 +1,710 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+# Rewrite a sliced G-code job for the planner limits of this firmware
+#
+#  gcodeopt.py [options] input.gcode [output.gcode]
+#
+# Limits and features are read from Configuration.h and Configuration_adv.h,
+# following their #if blocks, so the output suits the same build. Lines are
+# read the way the command queue and GCodeParser read them.
+#
+#  - Comments, line numbers, checksums, repeated F words and unchanged
+#    axis words are dropped.
+#  - With ARC_SUPPORT, runs of short moves on a circle become G2/G3. The
+#    chords plan_arc() will cut must also stay within the tolerance.
+#  - Collinear moves are merged. So are moves below MIN_STEPS_PER_SEGMENT,
+#    which the planner would drop anyway.
+#  - With MIXING_EXTRUDER, M163/M164 and G1 mix factors are only kept
+#    when the mix of the virtual tool changes.
+#
+# The print time is estimated before and after, with the planner model from
+# stepjob.py and only BLOCK_BUFFER_SIZE blocks of lookahead. Without an
+# output file only the estimate is printed.
+
+import sys,os,re,math,argparse,types
+from collections import deque
+from stepjob import Move, junction_speed
+
+AXES = 'XYZE'
+MIX_LETTERS = 'ABCDHI'
+
+#
+# Configuration
+#
+
+class Resolver(dict):
+	'''Names in #if expressions and #define values, looked up on demand'''
+	def __init__(self, defs):
+		super().__init__()
+		self.defs = defs
+	def __missing__(self, key):
+		return value(self.defs, key, 0)
+
+def value(defs, name, default=None):
+	'''Numeric value of a #define. Braced lists come back as lists.'''
+	if name not in defs: return default
+	text = re.sub(r'(?<=[\d.])[uUlLfF]+\b', '', defs[name]).strip()
+	if not text: return default
+	if text.startswith('{'): text = '[' + text.strip('{}') + ']'
+	try:
+		return eval(text, {'__builtins__': {}}, Resolver(defs))
+	except Exception:
+		return default
+
+def enabled(defs, name):
+	return name in defs and defs[name] not in ('0', 'false')
+
+def condition(expr, defs):
+	def flags(m):
+		on = [enabled(defs, n.strip()) for n in m.group(2).split(',')]
+		op = m.group(1)
+		if op in ('DISABLED', 'NONE'): r = not any(on)
+		elif op in ('EITHER', 'ANY'): r = any(on)
+		else: r = all(on)
+		return ' 1 ' if r else ' 0 '
+	expr = re.sub(r'\b(ENABLED|DISABLED|BOTH|EITHER|ANY|ALL|NONE)\s*\(([^()]*)\)', flags, expr)
+	expr = re.sub(r'\bdefined\s*\(\s*(\w+)\s*\)|\bdefined\s+(\w+)', lambda m: ' 1 ' if (m.group(1) or m.group(2)) in defs else ' 0 ', expr)
+	expr = re.sub(r'\b[A-Z_]\w*\s*\([^()]*\)', ' 0 ', expr)   # MB(), PIN_EXISTS() and friends
+	expr = re.sub(r'(?<=[\d.])[uUlLfF]+\b', '', expr)
+	expr = expr.replace('&&', ' and ').replace('||', ' or ')
+	expr = re.sub(r'!(?!=)', ' not ', expr)
+	try:
+		return bool(eval(expr, {'__builtins__': {}}, Resolver(defs)))
+	except Exception:
+		return False
+
+def read_config(folder):
+	'''The #defines that are active, following #if blocks as the preprocessor does'''
+	defs = {}
+	for name in ('Configuration.h', 'Configuration_adv.h'):
+		with open(os.path.join(folder, name), 'rt', encoding='utf-8', errors='replace') as f:
+			text = re.sub(r'/\*.*?\*/', ' ', f.read(), flags=re.S)
+		stack = []                  # (this branch is live, a branch was taken)
+		for line in text.splitlines():
+			m = re.match(r'\s*#\s*(\w+)\s*(.*)', line.split('//', 1)[0])
+			if not m: continue
+			d, rest = m.group(1), m.group(2).strip()
+			live = all(s[0] for s in stack)
+			if d in ('if', 'ifdef', 'ifndef'):
+				if not live: c = None
+				elif d == 'ifdef': c = rest in defs
+				elif d == 'ifndef': c = rest not in defs
+				else: c = condition(rest, defs)
+				stack.append((bool(c), c is not False))
+			elif d == 'elif':
+				_, taken = stack.pop()
+				c = not taken and condition(rest, defs)
+				stack.append((c, taken or c))
+			elif d == 'else':
+				_, taken = stack.pop()
+				stack.append((not taken, True))
+			elif d == 'endif':
+				stack.pop()
+			elif live and d == 'define':
+				m = re.match(r'(\w+)(.*)', rest)
+				defs[m.group(1)] = m.group(2).strip()
+			elif live and d == 'undef':
+				defs.pop(rest, None)
+	return defs
+
+def machine(defs):
+	def need(name):
+		v = value(defs, name)
+		if v is None: sys.exit(name + ' not found in the configuration')
+		return v
+
+	cfg = types.SimpleNamespace()
+	cfg.steps = [float(v) for v in need('DEFAULT_AXIS_STEPS_PER_UNIT')[:4]]
+	cfg.max_feedrate = [float(v) for v in need('DEFAULT_MAX_FEEDRATE')[:4]]
+	cfg.max_accel = [float(v) for v in need('DEFAULT_MAX_ACCELERATION')[:4]]
+	cfg.accel = float(need('DEFAULT_ACCELERATION'))
+	cfg.travel_accel = float(value(defs, 'DEFAULT_TRAVEL_ACCELERATION', cfg.accel))
+	if enabled(defs, 'CLASSIC_JERK'):
+		cfg.jerk = [float(value(defs, 'DEFAULT_%sJERK' % a, d)) for a, d in zip(AXES, (10, 10, 0.3, 5))]
+		cfg.junction_deviation = None
+	else:
+		cfg.jerk = None
+		cfg.junction_deviation = float(value(defs, 'JUNCTION_DEVIATION_MM', 0.013))
+	cfg.min_steps = int(value(defs, 'MIN_STEPS_PER_SEGMENT', 6))
+	cfg.block_buffer = int(value(defs, 'BLOCK_BUFFER_SIZE', 16))
+	cfg.max_cmd = int(value(defs, 'MAX_CMD_SIZE', 96))
+	cfg.corexy = enabled(defs, 'COREXY')
+
+	cfg.arcs = enabled(defs, 'ARC_SUPPORT')
+	cfg.mm_per_arc_segment = float(value(defs, 'MM_PER_ARC_SEGMENT', 1))
+	cfg.min_arc_segments = int(value(defs, 'MIN_ARC_SEGMENTS', 0))
+	cfg.arc_segments_per_r = value(defs, 'ARC_SEGMENTS_PER_R')
+	cfg.arc_segments_per_sec = value(defs, 'ARC_SEGMENTS_PER_SEC')
+
+	cfg.mixing = int(value(defs, 'MIXING_STEPPERS', 0)) if enabled(defs, 'MIXING_EXTRUDER') else 0
+	cfg.direct_mixing = cfg.mixing and enabled(defs, 'DIRECT_MIXING_IN_G1')
+	return cfg
+
+#
+# Reading
+#
+
+class Line:
+	'''A command passed through as text'''
+	def __init__(self, text, dwell=0.0):
+		self.text, self.dwell = text, dwell
+
+class Seg:
+	'''A G0-G3 move. Positions are absolute and None where unknown.'''
+	def __init__(self, cmd, words, start, end, f, absolute, abs_e, extra):
+		self.cmd, self.words, self.start, self.end, self.f = cmd, words, start, end, f
+		self.absolute, self.abs_e, self.extra = absolute, abs_e, extra
+		self.center = None          # (X, Y) for G2/G3
+		self.fitted = False         # Words are rebuilt from start and end
+
+	@property
+	def de(self):
+		if self.start[3] is None or self.end[3] is None: return None
+		return self.end[3] - self.start[3]
+
+# Commands that leave the position and feedrate alone
+KEEPS_STATE = {
+	'G4', 'G90', 'G91', 'G92', 'M82', 'M83',
+	'M104', 'M105', 'M106', 'M107', 'M109', 'M140', 'M141', 'M190', 'M191',
+	'M73', 'M75', 'M76', 'M77', 'M31', 'M115', 'M117', 'M118', 'M27',
+	'M201', 'M203', 'M204', 'M205', 'M220', 'M221', 'M300', 'M400',
+	'M163', 'M164', 'M165',
+}
+
+def clean(line):
+	'''Drop the comment, line number and checksum as the command queue does'''
+	line = line.split(';', 1)[0].strip()
+	if line[:1] in ('N', 'n'):
+		line = re.sub(r'^[Nn]\d+\s*', '', line)
+		line = re.sub(r'\*\d*$', '', line).rstrip()
+	return line
+
+def parse_words(text):
+	'''Parameter letters and values. A letter alone has the value None.'''
+	words = {}
+	for m in re.finditer(r'([A-Z])\s*([-+]?(?:\d+\.?\d*|\.\d+))?', text.upper()):
+		words[m.group(1)] = float(m.group(2)) if m.group(2) else None
+	return words
+
+def fmt(v, places):
+	s = '%.*f' % (places, v)
+	if '.' in s: s = s.rstrip('0').rstrip('.')
+	return '0' if s in ('-0', '') else s
+
+def normalize(mix):
+	if any(v is None for v in mix): return None
+	total = sum(mix)
+	return [v / total for v in mix] if total > 0 else None
+
+def same_mix(a, b):
+	return a is not None and b is not None and max(abs(x - y) for x, y in zip(a, b)) < 0.005
+
+class Reader:
+	'''Turn lines into items, tracking what the firmware knows at each line'''
+	def __init__(self, cfg, keep_comments):
+		self.cfg, self.keep_comments = cfg, keep_comments
+		self.pos = [None, None, None, 0.0]
+		self.absolute = self.abs_e = True
+		self.f = None
+		self.items = []
+		self.stats = types.SimpleNamespace(mixes_dropped=0, lines_in=0, bytes_in=0)
+		# Mixing state: the collector the input has set, the mix of each virtual tool,
+		# and the collector entries that differ in the firmware after a dropped mix
+		n = cfg.mixing
+		self.collector, self.fw_collector, self.vtool, self.mixes, self.pending = [None] * n, [None] * n, 0, {}, []
+
+	def forget(self):
+		'''After a command that moves on its own. E keeps its logical position.'''
+		self.pos = [None] * 3 + self.pos[3:]
+		self.f = None
+
+	def emit(self, text, dwell=0.0):
+		self.items.append(Line(text, dwell))
+
+	def flush_mix(self):
+		'''
+		Send the pending M163 lines. Entries skipped with a dropped mix
+		are sent again if the firmware has a different value.
+		'''
+		if not self.pending: return
+		for i, v in enumerate(self.collector):
+			if v is not None and (v != self.fw_collector[i] or any(s == i for s, _ in self.pending)):
+				self.emit('M163 S%d P%s' % (i, fmt(v, 3)))
+				self.fw_collector[i] = v
+		self.pending = []
+
+	def read(self, raw):
+		self.stats.lines_in += 1
+		self.stats.bytes_in += len(raw)
+		stripped = raw.strip()
+		if self.keep_comments and stripped.startswith(';'):
+			self.emit(stripped)
+			return
+		line = clean(raw)
+		if not line: return
+		m = re.match(r'([GgMmTt])\s*(\d+)(\.\d+)?', line)
+		if not m:
+			self.emit(line)
+			return
+		code = m.group(1).upper() + str(int(m.group(2)))
+		if m.group(3) or code in ('M23', 'M28', 'M30', 'M32', 'M33', 'M117', 'M118', 'M928'):
+			self.other(code, line, {})
+			return
+		words = parse_words(line[m.end():])
+		if code in ('G0', 'G1', 'G2', 'G3'): self.move(code, words, line)
+		elif code == 'M163' and self.cfg.mixing: self.m163(words, line)
+		elif code == 'M164' and self.cfg.mixing: self.m164(words, line)
+		else: self.other(code, line, words)
+
+	def other(self, code, line, words):
+		self.flush_mix()
+		dwell = 0.0
+		if code == 'G90': self.absolute = self.abs_e = True
+		elif code == 'G91': self.absolute = self.abs_e = False
+		elif code == 'M82': self.abs_e = True
+		elif code == 'M83': self.abs_e = False
+		elif code == 'G4': dwell = (words.get('P') or 0) / 1000 + (words.get('S') or 0)
+		elif code == 'G92':
+			for i, a in enumerate(AXES):
+				if words.get(a) is not None: self.pos[i] = words[a]
+		elif code[0] == 'T' and self.cfg.mixing:
+			self.vtool = int(code[1:])
+		elif self.cfg.mixing and code == 'M165':
+			if not self.g1_mix(words): return
+		elif code not in KEEPS_STATE:
+			self.forget()
+		self.emit(line, dwell)
+
+	def m163(self, words, line):
+		s = int(words.get('S') or 0)
+		n = self.cfg.mixing
+		if s < n:
+			self.collector[s] = words.get('P') or 0.0
+			self.pending.append((s, line))
+		else:
+			self.flush_mix()
+			if s > n: self.mixes.clear()   # Resets all virtual tools
+			self.emit(line)
+
+	def m164(self, words, line):
+		t = self.vtool if words.get('S') is None else int(words['S'])
+		mix = normalize(self.collector)
+		if same_mix(mix, self.mixes.get(t)):
+			self.pending = []
+			self.stats.mixes_dropped += 1
+			return
+		self.flush_mix()
+		self.emit(line)
+		if mix is None: self.mixes.pop(t, None)
+		else: self.mixes[t] = mix
+
+	def g1_mix(self, words):
+		'''G1 mix factors act like M165. Returns False if the mix is already active.'''
+		n = self.cfg.mixing
+		given = [words.get(a) for a in MIX_LETTERS[:n]]
+		if all(v is None for v in given): return True
+		collector = [v or 0.0 for v in given]
+		mix = normalize(collector)
+		self.collector = collector
+		if same_mix(mix, self.mixes.get(self.vtool)):
+			self.stats.mixes_dropped += 1
+			return False
+		self.fw_collector = list(collector)
+		if mix is None: self.mixes.pop(self.vtool, None)
+		else: self.mixes[self.vtool] = mix
+		return True
+
+	def move(self, code, words, line):
+		self.flush_mix()
+		if words.get('F'): self.f = words['F']
+		if self.cfg.direct_mixing and not self.g1_mix(words):
+			for a in MIX_LETTERS[:self.cfg.mixing]: words.pop(a, None)
+
+		start, end = list(self.pos), list(self.pos)
+		for i, a in enumerate(AXES):
+			if a not in words: continue
+			v = words[a] or 0.0
+			rel = not (self.abs_e if a == 'E' else self.absolute)
+			end[i] = (start[i] + v if start[i] is not None else None) if rel else v
+		extra = { k: v for k, v in words.items() if k not in AXES + 'F' }
+		seg = Seg(code, words, start, end, self.f, self.absolute, self.abs_e, extra)
+
+		if code in ('G2', 'G3'):
+			seg.center = arc_center(seg, code == 'G2')
+			if seg.center is None:      # Can't follow it, so pass it through
+				self.emit(line)
+				self.forget()
+				return
+		self.items.append(seg)
+		self.pos = end
+
+def arc_center(seg, clockwise):
+	'''Center of a G2/G3 from I J or R, as G2_G3.cpp works it out'''
+	if any(v is None for v in seg.start[:2] + seg.end[:2]): return None
+	p1, q1, p2, q2 = seg.start[0], seg.start[1], seg.end[0], seg.end[1]
+	if seg.extra.get('R') is not None:
+		r = seg.extra['R']
+		if not r or (p1 == p2 and q1 == q2): return None
+		e = -1 if clockwise ^ (r < 0) else 1
+		dx, dy = p2 - p1, q2 - q1
+		d = math.hypot(dx, dy)
+		h = math.sqrt(max(0.0, r * r - (d / 2) ** 2))
+		return ((p1 + p2) / 2 + e * h * -dy / d, (q1 + q2) / 2 + e * h * dx / d)
+	i, j = seg.extra.get('I') or 0.0, seg.extra.get('J') or 0.0
+	if not (i or j): return None
+	return (p1 + i, q1 + j)
+
+#
+# Geometry
+#
+
+def motor_steps(delta, cfg):
+	x, y, z, e = (d * s for d, s in zip(delta, cfg.steps))
+	if cfg.corexy: x, y = x + y, x - y
+	return [abs(v) for v in (x, y, z, e)]
+
+def substep(p, q, cfg):
+	'''The planner drops a block with fewer steps than this on every stepper'''
+	return max(motor_steps([b - a for a, b in zip(p, q)], cfg)) < cfg.min_steps
+
+def arc_chords(start, end, center, clockwise, f_mm_s, cfg):
+	'''The points plan_arc() will move through, ending at the target'''
+	cx, cy = center
+	rx, ry = start[0] - cx, start[1] - cy
+	tx, ty = end[0] - cx, end[1] - cy
+	radius = math.hypot(rx, ry)
+	ang = math.atan2(rx * ty - ry * tx, rx * tx + ry * ty)
+	if ang < 0: ang += 2 * math.pi
+	min_segments = max(1, math.ceil(cfg.min_arc_segments * ang / (2 * math.pi))) if cfg.min_arc_segments else 1
+	if clockwise: ang -= 2 * math.pi
+	if ang == 0 and start[0] == end[0] and start[1] == end[1]:
+		ang = 2 * math.pi
+		min_segments = cfg.min_arc_segments or 1
+	flat = radius * ang
+	linear = end[2] - start[2]
+	mm = math.hypot(flat, linear) if linear else abs(flat)
+	if mm < 0.001: return []
+	seg_len = cfg.mm_per_arc_segment
+	if cfg.arc_segments_per_r:
+		seg_len = min(max(cfg.mm_per_arc_segment * radius, cfg.mm_per_arc_segment), cfg.arc_segments_per_r)
+	elif cfg.arc_segments_per_sec:
+		seg_len = max(f_mm_s / cfg.arc_segments_per_sec, cfg.mm_per_arc_segment)
+	segments = max(int(mm / seg_len), min_segments)
+	points = []
+	for n in range(1, segments):
+		t = n / segments
+		a = ang * t
+		c, s = math.cos(a), math.sin(a)
+		points.append([cx + rx * c - ry * s, cy + rx * s + ry * c, start[2] + linear * t, start[3] + (end[3] - start[3]) * t])
+	points.append(list(end))
+	return points
+
+def circle(a, b, c):
+	ax, ay = a[0], a[1]
+	bx, by = b[0], b[1]
+	cx, cy = c[0], c[1]
+	d = 2 * (ax * (by - cy) + bx * (cy - ay) + cx * (ay - by))
+	if abs(d) < 1e-9: return None
+	a2, b2, c2 = ax * ax + ay * ay, bx * bx + by * by, cx * cx + cy * cy
+	ux = (a2 * (by - cy) + b2 * (cy - ay) + c2 * (ay - by)) / d
+	uy = (a2 * (cx - bx) + b2 * (ax - cx) + c2 * (bx - ax)) / d
+	return ux, uy, math.hypot(ax - ux, ay - uy)
+
+def even_flow(pts, i, j):
+	'''E per mm the same along pts[i..j], so one move can replace them'''
+	lengths = [math.dist(pts[k][:3], pts[k + 1][:3]) for k in range(i, j)]
+	des = [pts[k + 1][3] - pts[k][3] for k in range(i, j)]
+	total_len, total_e = sum(lengths), sum(des)
+	if total_len <= 0: return False
+	rate = total_e / total_len
+	return all(abs(de - rate * ln) <= 0.05 * abs(rate) * ln + 1e-5 for de, ln in zip(des, lengths))
+
+def fit_arc(pts, i, j, f_mm_s, cfg, tol):
+	'''
+	Center and direction of an arc through pts[i..j] within tol. False if the
+	points fit but the firmware would cut the arc too coarsely, None if not.
+	'''
+	if any(p[2] != pts[i][2] for p in pts[i:j + 1]): return None
+	c = circle(pts[i], pts[(i + j) // 2], pts[j])
+	if not c: return None
+	cx, cy, r = c
+	if not (0.5 <= r <= 1000): return None
+	sweep, sign = 0.0, 0
+	for k in range(i, j):
+		p, q = pts[k], pts[k + 1]
+		if abs(math.hypot(q[0] - cx, q[1] - cy) - r) > tol: return None
+		if abs(math.hypot((p[0] + q[0]) / 2 - cx, (p[1] + q[1]) / 2 - cy) - r) > tol: return None
+		px, py, qx, qy = p[0] - cx, p[1] - cy, q[0] - cx, q[1] - cy
+		step = math.atan2(px * qy - py * qx, px * qx + py * qy)
+		if step == 0 or abs(step) > math.pi / 4 or (sign and (step > 0) != (sign > 0)): return None
+		sign = step
+		sweep += step
+	if abs(sweep) >= 2 * math.pi - 0.01: return None
+	clockwise = sweep < 0
+	# The chords the firmware cuts must also stay close to the original path
+	prev = pts[i]
+	for q in arc_chords(pts[i], pts[j], (cx, cy), clockwise, f_mm_s, cfg):
+		mx, my = (prev[0] + q[0]) / 2, (prev[1] + q[1]) / 2
+		if r - math.hypot(mx - cx, my - cy) > tol: return False
+		prev = q
+	return (cx, cy), clockwise
+
+def fit_line(pts, i, j, cfg, tol):
+	'''pts[i..j] lie along a line within tol. Points the planner would drop don't count.'''
+	a, b = pts[i], pts[j]
+	d = [y - x for x, y in zip(a[:3], b[:3])]
+	ln = math.sqrt(sum(v * v for v in d))
+	if ln <= 0: return False
+	u = [v / ln for v in d]
+	last_t = 0.0
+	for k in range(i + 1, j):
+		p = pts[k]
+		if substep(pts[k - 1], p, cfg): continue
+		w = [y - x for x, y in zip(a[:3], p[:3])]
+		t = sum(x * y for x, y in zip(w, u))
+		if t < last_t - tol or t > ln + tol: return False
+		off = math.sqrt(max(0.0, sum(x * x for x in w) - t * t))
+		if off > tol: return False
+		last_t = t
+	return True
+
+MAX_FIT = 200
+
+def optimize_run(run, cfg, opts, stats):
+	'''Replace a run of plain G0/G1 moves with fewer moves along the same path'''
+	pts = [run[0].start] + [s.end for s in run]
+	proto = run[0]
+	f_mm_s = (proto.f or 0) / 60
+	out, i, n = [], 0, len(run)
+
+	def make(i, j, center=None, clockwise=False):
+		seg = Seg(proto.cmd, None, pts[i], pts[j], proto.f, True, proto.abs_e, {})
+		seg.fitted = True
+		if center:
+			seg.cmd, seg.center = ('G2' if clockwise else 'G3'), center
+		out.append(seg)
+
+	while i < n:
+		if opts.arcs and cfg.arcs and n - i >= opts.arc_min:
+			j, best = i + opts.arc_min, None
+			while j <= n and j - i <= MAX_FIT:
+				fit = fit_arc(pts, i, j, f_mm_s, cfg, opts.tolerance) if even_flow(pts, i, j) else None
+				if fit is None: break
+				if fit: best = (j, fit)
+				j += 1
+			if best:
+				j, (center, clockwise) = best
+				make(i, j, center, clockwise)
+				stats.arcs += 1
+				stats.arc_moves += j - i
+				i = j
+				continue
+		j = i + 1
+		if opts.merge:
+			while j < n and j + 1 - i <= MAX_FIT and even_flow(pts, i, j + 1) and fit_line(pts, i, j + 1, cfg, opts.tolerance):
+				j += 1
+			stats.merged += j - i - 1
+		if j - i == 1: out.append(run[i])
+		else: make(i, j)
+		i = j
+	return out
+
+def plain(seg, prev):
+	'''A G0/G1 the geometry passes may rework'''
+	return (seg.cmd in ('G0', 'G1') and seg.absolute and not seg.extra
+		and all(v is not None for v in seg.start + seg.end)
+		and max(abs(b - a) for a, b in zip(seg.start[:3], seg.end[:3])) > 0 and seg.de >= 0
+		and (prev is None or (seg.cmd == prev.cmd and seg.f == prev.f and seg.abs_e == prev.abs_e
+			and (seg.de > 0) == (prev.de > 0))))
+
+def optimize(items, cfg, opts, stats):
+	out, run = [], []
+	def flush():
+		if len(run) > 1: out.extend(optimize_run(run, cfg, opts, stats))
+		else: out.extend(run)
+		run.clear()
+	for it in items:
+		if isinstance(it, Seg) and plain(it, run[-1] if run else None):
+			run.append(it)
+			continue
+		flush()
+		if isinstance(it, Seg) and plain(it, None): run.append(it)
+		else: out.append(it)
+	flush()
+	return out
+
+#
+# Writing
+#
+
+def write(items):
+	'''Text for the items, leaving out words the firmware already has'''
+	lines, out_f = [], None
+	for it in items:
+		if isinstance(it, Line):
+			lines.append(it.text)
+			code = re.match(r'[GMT]\d+', it.text.upper())
+			if code and code.group(0) not in KEEPS_STATE and not it.text.startswith(';'): out_f = None
+			continue
+		words = []
+		for k, a in enumerate(AXES):
+			places = 5 if a == 'E' else 3
+			abs_axis = it.abs_e if a == 'E' else it.absolute
+			if it.fitted:
+				if it.start[k] is not None and fmt(it.end[k], places) == fmt(it.start[k], places): continue
+				v = it.end[k] if abs_axis else it.end[k] - it.start[k]
+			else:
+				if a not in it.words: continue
+				v = it.words[a] or 0.0
+				if abs_axis and it.start[k] is not None and fmt(v, places) == fmt(it.start[k], places): continue
+				if not abs_axis and fmt(v, places) == '0': continue
+			words.append(a + fmt(v, places))
+		if it.fitted and it.center:
+			words.append('I' + fmt(it.center[0] - it.start[0], 3))
+			words.append('J' + fmt(it.center[1] - it.start[1], 3))
+		for k, v in it.extra.items():
+			words.append(k if v is None else k + fmt(v, 5))
+		if not words: continue      # Only F. The next move will carry it.
+		if it.f is not None and it.f != out_f:
+			words.append('F' + fmt(it.f, 0 if it.f == int(it.f) else 2))
+			out_f = it.f
+		lines.append(it.cmd + ' ' + ' '.join(words))
+	return lines
+
+#
+# Estimate
+#
+
+def estimate(items, cfg):
+	'''Seconds of motion and planner blocks, with BLOCK_BUFFER_SIZE blocks of lookahead'''
+	print_cfg = cfg
+	travel_cfg = types.SimpleNamespace(**vars(cfg))
+	travel_cfg.accel = cfg.travel_accel
+	pos, moves, blocks = [0.0] * 4, [], 0
+
+	def add(target, f_mm_s):
+		nonlocal pos, blocks
+		delta = [b - a for a, b in zip(pos, target)]
+		if max(motor_steps(delta, cfg)) < cfg.min_steps: return
+		blocks += 1
+		c = print_cfg if delta[3] else travel_cfg
+		moves.append(Move(list(pos), delta, f_mm_s, c))
+		pos = target
+
+	for it in items:
+		if isinstance(it, Line):
+			if it.dwell:
+				m = Move(list(pos), [0.0] * 4, 1, cfg)
+				m.dwell = it.dwell
+				moves.append(m)
+			continue
+		f_mm_s = (it.f or 3000) / 60
+		start = [a if a is not None else p for a, p in zip(it.start, pos)]
+		end = [b if b is not None else a for a, b in zip(start, it.end)]
+		pos = start
+		if it.center:
+			for p in arc_chords(start, end, it.center, it.cmd == 'G2', f_mm_s, cfg): add(p, f_mm_s)
+		else:
+			add(end, f_mm_s)
+		pos = end
+
+	plan(moves, cfg)
+	return sum(m.duration for m in moves), blocks
+
+def plan(moves, cfg):
+	'''As stepjob.plan(), but each block must be able to stop within the buffer'''
+	prev = None
+	for move in moves:
+		if move.length:
+			move.v_entry_max = junction_speed(prev, move, cfg) if prev else move.safe_speed(cfg)
+			prev = move
+		else:
+			move.v_entry_max, prev = 0.0, None
+	window, ahead, ahead_mm = cfg.block_buffer - 1, deque(), 0.0
+	v_next = 0.0
+	for move in reversed(moves):
+		if move.length:
+			move.v_exit = min(v_next, math.sqrt(2 * move.accel * ahead_mm))
+			move.v_entry = min(move.v_entry_max, math.sqrt(move.v_exit ** 2 + 2 * move.accel * move.length))
+			v_next = move.v_entry
+			ahead.appendleft(move.length)
+			ahead_mm += move.length
+			if len(ahead) > window: ahead_mm -= ahead.pop()
+		else:
+			v_next, ahead, ahead_mm = 0.0, deque(), 0.0
+	v_prev = None
+	for move in moves:
+		if move.length:
+			if v_prev is not None: move.v_entry = min(move.v_entry, v_prev)
+			move.v_exit = min(move.v_exit, math.sqrt(move.v_entry ** 2 + 2 * move.accel * move.length))
+			v_prev = move.v_exit
+		else:
+			v_prev = None
+		move.profile()
+
+def hms(t):
+	t = int(round(t))
+	return '%d:%02d:%02d' % (t // 3600, t // 60 % 60, t % 60)
+
+def main():
+	here = os.path.dirname(os.path.abspath(__file__))
+	parser = argparse.ArgumentParser(description='Optimize G-code for the Marlin planner')
+	parser.add_argument('input')
+	parser.add_argument('output', nargs='?', help='Leave out to only estimate the print time')
+	parser.add_argument('--config', default=os.path.join(here, '..', '..', '..', 'Marlin'), help='Folder with Configuration.h')
+	parser.add_argument('--tolerance', type=float, default=0.01, help='Largest path deviation (mm)')
+	parser.add_argument('--arc-min', type=int, default=4, help='Fewest moves to replace with an arc')
+	parser.add_argument('--no-arcs', dest='arcs', action='store_false')
+	parser.add_argument('--no-merge', dest='merge', action='store_false')
+	parser.add_argument('--keep-comments', action='store_true', help='Keep whole-line comments')
+	opts = parser.parse_args()
+
+	cfg = machine(read_config(opts.config))
+	reader = Reader(cfg, opts.keep_comments)
+	with open(opts.input, 'rt', encoding='utf-8', errors='replace') as f:
+		for line in f: reader.read(line)
+	reader.flush_mix()
+	items = reader.items
+
+	stats = types.SimpleNamespace(arcs=0, arc_moves=0, merged=0)
+	result = optimize(items, cfg, opts, stats)
+	lines = write(result)
+	too_long = [l for l in lines if len(l) >= cfg.max_cmd]
+	if too_long: print('%d lines are longer than MAX_CMD_SIZE' % len(too_long), file=sys.stderr)
+
+	t_in, blocks_in = estimate(items, cfg)
+	t_out, blocks_out = estimate(result, cfg)
+	bytes_out = sum(len(l) + 1 for l in lines)
+
+	if opts.output:
+		with open(opts.output, 'wt') as f:
+			f.write('\n'.join(lines) + '\n')
+
+	print('Lines  %9d -> %d' % (reader.stats.lines_in, len(lines)))
+	print('Bytes  %9d -> %d' % (reader.stats.bytes_in, bytes_out))
+	print('Blocks %9d -> %d' % (blocks_in, blocks_out))
+	print('Time   %9s -> %s' % (hms(t_in), hms(t_out)))
+	print('%d arcs replace %d moves, %d moves merged, %d repeated mixes dropped' % (stats.arcs, stats.arc_moves, stats.merged, reader.stats.mixes_dropped))
+
+if __name__ == '__main__':
+	main()
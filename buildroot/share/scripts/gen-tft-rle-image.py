@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+# Generate run-length encoded Marlin TFT Images
+#
+# GREYSCALE4_RLE: One byte per run. High nibble is the run length - 1,
+#                 low nibble is the palette index (0 = transparent).
+# HIGHCOLOR_RLE:  One 16-bit token per run. With bit 15 set the next word is
+#                 repeated (token & 0x7FFF) + 1 times, otherwise the next
+#                 token + 1 words are copied as they are.
+#
+# Runs continue across image rows.
+
+import sys,re
+
+def rle4(nibbles):
+	out = []
+	i = 0
+	while i < len(nibbles):
+		n = 1
+		while i + n < len(nibbles) and n < 16 and nibbles[i + n] == nibbles[i]: n += 1
+		out.append(((n - 1) << 4) | nibbles[i])
+		i += n
+	return out
+
+def rle16(pixels):
+	out = []
+	literal = []
+	def flush():
+		if literal:
+			out.append(len(literal) - 1)
+			out.extend(literal)
+			del literal[:]
+	i = 0
+	while i < len(pixels):
+		n = 1
+		while i + n < len(pixels) and n < 0x8000 and pixels[i + n] == pixels[i]: n += 1
+		if n >= 3:
+			flush()
+			out.extend([0x8000 | (n - 1), pixels[i]])
+			i += n
+		else:
+			literal.append(pixels[i])
+			if len(literal) == 0x8000: flush()
+			i += 1
+	flush()
+	return out
+
+def unrle4(data, count):
+	out = []
+	for b in data: out += [b & 0x0F] * ((b >> 4) + 1)
+	return out[:count]
+
+def unrle16(data, count):
+	out = []
+	i = 0
+	while i < len(data):
+		t = data[i]
+		if t & 0x8000:
+			out += [data[i + 1]] * ((t & 0x7FFF) + 1)
+			i += 2
+		else:
+			out += data[i + 1:i + t + 2]
+			i += t + 2
+	return out[:count]
+
+def c_array(ctype, name, values, fmt):
+	lines = []
+	for i in range(0, len(values), 16):
+		lines.append('  ' + ', '.join(fmt.format(v) for v in values[i:i + 16]))
+	return 'extern const %s %s[%d] = {\n%s\n};' % (ctype, name, len(values), ',\n'.join(lines))
+
+# Compress the raw arrays found in a Marlin image source file, in place
+def compress_source(filename):
+	src = open(filename, 'rt').read()
+	pattern = re.compile(r'extern const (uint8_t|uint16_t) (\w+_(\d+)x(\d+)x(4|16))\[(\d+)\] = \{([^}]*)\};')
+	def replace(m):
+		ctype, name, w, h, bpp, size = m.group(1), m.group(2), int(m.group(3)), int(m.group(4)), int(m.group(5)), int(m.group(6))
+		values = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', m.group(7))]
+		values += [0] * (size - len(values))
+		if size != (w * h * bpp // 8 if ctype == 'uint8_t' else w * h):
+			print("%s: %s is already compressed" % (filename, name))
+			return m.group(0)
+		if bpp == 4:
+			pixels = []
+			for v in values: pixels += [v >> 4, v & 0x0F]
+			packed = rle4(pixels)
+			assert unrle4(packed, w * h) == pixels
+			fmt = '0x{0:02X}'
+		else:
+			pixels = values
+			packed = rle16(pixels)
+			assert unrle16(packed, w * h) == pixels
+			fmt = '0x{0:04X}'
+		print("%s: %s %d -> %d bytes" % (filename, name, size * (2 if bpp == 16 else 1), len(packed) * (2 if bpp == 16 else 1)))
+		return c_array(ctype, name, packed, fmt)
+	open(filename, 'wt').write(pattern.sub(replace, src))
+
+# Convert a bitmap to a HIGHCOLOR_RLE array
+def image2rle(input_file, output_file, name):
+	from PIL import Image
+	image = Image.open(input_file).convert('RGB')
+	pixs = image.load()
+	pixels = []
+	for y in range(image.size[1]):
+		for x in range(image.size[0]):
+			R = pixs[x, y][0] >> 3
+			G = pixs[x, y][1] >> 2
+			B = pixs[x, y][2] >> 3
+			pixels.append((R << 11) | (G << 5) | B)
+	name = "%s_%dx%dx16" % (name, image.size[0], image.size[1])
+	f = open(output_file, 'wt')
+	f.write(c_array('uint16_t', name, rle16(pixels), '0x{0:04X}') + '\n')
+	f.close()
+
+if len(sys.argv) > 1 and all(f.endswith('.cpp') for f in sys.argv[1:]):
+	for f in sys.argv[1:]: compress_source(f)
+elif len(sys.argv) == 4:
+	image2rle(sys.argv[1], sys.argv[2], sys.argv[3])
+else:
+	print("Utility to create run-length encoded images for the Marlin TFT UI.")
+	print("Usage: gen-tft-rle-image.py IMAGE_SOURCE.cpp [...]")
+	print("         Compress the x4 and x16 arrays in Marlin image sources in place.")
+	print("       gen-tft-rle-image.py INPUT_IMAGE.(png|bmp|jpg) OUTPUT_FILE.cpp NAME")
+	print("         Create a HIGHCOLOR_RLE array named NAME_<width>x<height>x16.")
+	exit(1)
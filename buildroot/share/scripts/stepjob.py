@@ -0,0 +1,331 @@
+#!/usr/bin/env python3
+#
+# Marlin 3D Printer Firmware
+# Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+#
+# Based on Sprinter and grbl.
+# Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+# Convert G-code moves to a direct stepping job for DIRECT_STEPPING_SD
+#
+#  stepjob.py [options] input.gcode output.stp
+#
+# The moves are planned with trapezoids and junction speeds like Marlin's
+# planner, then sampled at the page step rate into step pages. The pages are
+# compressed with heatshrink (window 8, lookahead 4) to match the firmware.
+#
+# Only motion is converted: G0 G1 G4 G90 G91 G92 M82 M83. Heat up, home, and
+# move to the start position (--start) before printing the job. Settings
+# should match the firmware: steps/mm, limits, kinematics, and page format.
+
+import sys,math,struct,argparse
+
+FORMATS = {
+	'SP_4x4D_128': (1, 4, True,  128),
+	'SP_4x2_256':  (4, 2, False, 256),
+	'SP_4x1_512':  (5, 1, False, 512),
+}
+
+WINDOW_BITS, LOOKAHEAD_BITS = 8, 4
+
+def heatshrink(data):
+	'''Compress bytes for the heatshrink decoder in Marlin (static w8 l4)'''
+	window, lookahead = 1 << WINDOW_BITS, 1 << LOOKAHEAD_BITS
+	out, acc, nbits = bytearray(), 0, 0
+
+	def put(value, bits):
+		nonlocal acc, nbits
+		acc = (acc << bits) | value
+		nbits += bits
+		while nbits >= 8:
+			nbits -= 8
+			out.append((acc >> nbits) & 0xFF)
+		acc &= (1 << nbits) - 1
+
+	i, n = 0, len(data)
+	while i < n:
+		# Longest match in the window. It may run on into the lookahead.
+		best, where, lo = 0, 0, max(0, i - window)
+		k = 2
+		while k <= min(lookahead, n - i):
+			j = data.rfind(data[i:i + k], lo, i + k - 1)
+			if j < 0: break
+			best, where = k, j
+			k += 1
+		if best:
+			put(0, 1)
+			put(i - where - 1, WINDOW_BITS)
+			put(best - 1, LOOKAHEAD_BITS)
+			i += best
+		else:
+			put(1, 1)
+			put(data[i], 8)
+			i += 1
+
+	if nbits: put(0, 8 - nbits)
+	return bytes(out)
+
+def axis_list(text, count=4):
+	vals = [float(v) for v in text.split(',')]
+	if len(vals) != count: raise argparse.ArgumentTypeError('expected %d values' % count)
+	return vals
+
+class Move:
+	def __init__(self, start, delta, feedrate, cfg):
+		self.start, self.delta = start, delta
+		xyz = math.sqrt(sum(d * d for d in delta[:3]))
+		self.length = xyz if xyz > 0 else abs(delta[3])
+		self.unit = [d / self.length for d in delta] if self.length else [0.0] * 4
+		self.dwell = 0.0
+		# Nominal speed and acceleration limited per axis, as the planner does
+		v, a = feedrate, cfg.accel
+		for i, u in enumerate(self.unit):
+			if abs(u) > 1e-9:
+				v = min(v, cfg.max_feedrate[i] / abs(u))
+				a = min(a, cfg.max_accel[i] / abs(u))
+		self.v_nominal, self.accel = v, a
+		self.v_entry = self.v_exit = 0.0
+
+	def safe_speed(self, cfg):
+		# Speed that may start or stop abruptly
+		v = self.v_nominal
+		if cfg.jerk:
+			for i, u in enumerate(self.unit):
+				if abs(u) > 1e-9: v = min(v, cfg.jerk[i] / abs(u))
+		else:
+			v = min(v, math.sqrt(cfg.accel * cfg.junction_deviation))
+		return v
+
+	def profile(self):
+		'''Set up a trapezoid from the entry and exit speeds'''
+		L, a, v0, v1 = self.length, self.accel, self.v_entry, self.v_exit
+		vc = min(self.v_nominal, math.sqrt(max(0.0, (2 * a * L + v0 * v0 + v1 * v1) / 2)))
+		vc = max(vc, v0, v1)
+		self.vc = vc
+		self.t_acc, self.t_dec = (vc - v0) / a, (vc - v1) / a
+		self.d_acc = (v0 + vc) / 2 * self.t_acc
+		self.d_dec = (vc + v1) / 2 * self.t_dec
+		d_cruise = max(0.0, L - self.d_acc - self.d_dec)
+		self.t_cruise = d_cruise / vc if vc > 0 else 0.0
+		self.duration = self.t_acc + self.t_cruise + self.t_dec if L else self.dwell
+
+	def distance_at(self, t):
+		if not self.length: return 0.0
+		if t <= self.t_acc:
+			return self.v_entry * t + self.accel * t * t / 2
+		t -= self.t_acc
+		if t <= self.t_cruise:
+			return self.d_acc + self.vc * t
+		t = min(t - self.t_cruise, self.t_dec)
+		return self.length - self.d_dec + self.vc * t - self.accel * t * t / 2
+
+	def position_at(self, t):
+		s = self.distance_at(t)
+		return [p + u * s for p, u in zip(self.start, self.unit)]
+
+def junction_speed(prev, move, cfg):
+	v = min(prev.v_nominal, move.v_nominal)
+	if cfg.jerk:
+		factor = 1.0
+		for i in range(4):
+			dv = abs(v * move.unit[i] - v * prev.unit[i])
+			if dv > cfg.jerk[i]: factor = min(factor, cfg.jerk[i] / dv)
+		return v * factor
+	cos_theta = -sum(p * m for p, m in zip(prev.unit[:3], move.unit[:3]))
+	if cos_theta > 0.999999: return min(prev.safe_speed(cfg), move.safe_speed(cfg))
+	if cos_theta < -0.999999: return v
+	sin_theta_d2 = math.sqrt(0.5 * (1.0 - cos_theta))
+	vj = math.sqrt(move.accel * cfg.junction_deviation * sin_theta_d2 / (1.0 - sin_theta_d2))
+	return min(v, vj)
+
+def read_moves(lines, cfg):
+	pos, absolute, abs_e = list(cfg.start), True, True
+	shift = [0.0] * 4             # G92 offset from G-code to machine position
+	feedrate, moves, ignored = 50.0, [], set()
+	for line in lines:
+		line = line.split(';', 1)[0].strip().upper()
+		if not line: continue
+		words = line.split()
+		if words[0].startswith('N'): words = words[1:]
+		if not words: continue
+		cmd, params = words[0], {}
+		for w in words[1:]:
+			try: params[w[0]] = float(w[1:])
+			except ValueError: pass
+		if cmd in ('G0', 'G1'):
+			if 'F' in params: feedrate = params['F'] / 60
+			target = list(pos)
+			for i, axis in enumerate('XYZE'):
+				if axis in params:
+					rel = not (abs_e if axis == 'E' else absolute)
+					target[i] = pos[i] + params[axis] if rel else params[axis]
+			delta = [t - p for t, p in zip(target, pos)]
+			if any(abs(d) > 1e-9 for d in delta):
+				moves.append(Move([p + o for p, o in zip(pos, shift)], delta, feedrate, cfg))
+			pos = target
+		elif cmd == 'G4':
+			move = Move([p + o for p, o in zip(pos, shift)], [0.0] * 4, feedrate, cfg)
+			move.dwell = params.get('P', 0) / 1000 + params.get('S', 0)
+			moves.append(move)
+		elif cmd == 'G90': absolute = abs_e = True
+		elif cmd == 'G91': absolute = abs_e = False
+		elif cmd == 'M82': abs_e = True
+		elif cmd == 'M83': abs_e = False
+		elif cmd == 'G92':
+			for i, axis in enumerate('XYZE'):
+				if axis in params:
+					shift[i] += pos[i] - params[axis]
+					pos[i] = params[axis]
+		else:
+			ignored.add(cmd)
+	if ignored: print('Ignored: ' + ' '.join(sorted(ignored)), file=sys.stderr)
+	return moves
+
+def plan(moves, cfg):
+	'''Junction speeds, then the backward and forward passes'''
+	prev = None
+	for move in moves:
+		if move.length:
+			move.v_entry_max = junction_speed(prev, move, cfg) if prev else move.safe_speed(cfg)
+			prev = move
+		else:
+			move.v_entry_max, prev = 0.0, None
+	v_next = 0.0
+	for move in reversed(moves):
+		if move.length:
+			move.v_exit = v_next
+			move.v_entry = min(move.v_entry_max, math.sqrt(v_next * v_next + 2 * move.accel * move.length))
+			v_next = move.v_entry
+		else:
+			v_next = 0.0
+	v_prev = None                 # At rest, a move may start at its safe speed
+	for move in moves:
+		if move.length:
+			if v_prev is not None: move.v_entry = min(move.v_entry, v_prev)
+			move.v_exit = min(move.v_exit, math.sqrt(move.v_entry * move.v_entry + 2 * move.accel * move.length))
+			v_prev = move.v_exit
+		else:
+			v_prev = None
+		move.profile()
+
+def motor_steps(pos, cfg):
+	x, y, z, e = pos
+	if cfg.kinematics == 'corexy': x, y = x + y, x - y
+	return [round(v * s) for v, s in zip((x, y, z, e), cfg.steps)]
+
+def sample(moves, cfg, seg_steps):
+	'''Steps per segment for each motor, from the planned moves'''
+	period = seg_steps / cfg.rate
+	total = sum(m.duration for m in moves)
+	emitted = motor_steps(cfg.start, cfg)
+	index, t_move, overflow, k = 0, 0.0, 0, 1
+	while True:
+		t = min(k * period, total)
+		while index < len(moves) - 1 and t > t_move + moves[index].duration:
+			t_move += moves[index].duration
+			index += 1
+		target = motor_steps(moves[index].position_at(t - t_move), cfg)
+		seg = []
+		for i in range(4):
+			d = target[i] - emitted[i]
+			if abs(d) > seg_steps:
+				overflow += 1
+				d = seg_steps if d > 0 else -seg_steps
+			emitted[i] += d
+			seg.append(d)
+		yield seg
+		if t >= total: break
+		k += 1
+	if overflow:
+		print('%d segments needed more steps than a segment holds. Raise --rate.' % overflow, file=sys.stderr)
+
+def paginate(segments, fmt, seg_steps, rate):
+	'''Pack segments into page records: rate, steps, directions, page'''
+	_, bits, directional, count = fmt
+	page_size = 4 * bits * count // 8
+	page, dirs = [], [None] * 4
+
+	def record():
+		data = bytearray(page_size)
+		if bits == 4: data = bytearray([0x77]) * page_size
+		for n, seg in enumerate(page):
+			if bits == 4:
+				v = [d + 7 for d in seg]
+				data[n * 2]     = (v[0] << 4) | v[1]
+				data[n * 2 + 1] = (v[2] << 4) | v[3]
+			elif bits == 2:
+				v = [abs(d) for d in seg]
+				data[n] = (v[0] << 6) | (v[1] << 4) | (v[2] << 2) | v[3]
+			else:
+				nib = (abs(seg[0]) << 3) | (abs(seg[1]) << 2) | (abs(seg[2]) << 1) | abs(seg[3])
+				data[n >> 1] |= nib << (4 if n & 1 else 0)
+		dir_bits = sum(1 << i for i in range(4) if dirs[i] is not False)
+		# Directional pages always run in full. The stepper counts them that way.
+		steps = (count if directional else len(page)) * seg_steps
+		return struct.pack('<IHB', rate, steps, dir_bits) + bytes(data)
+
+	for seg in segments:
+		if not directional:
+			# One direction per axis in a page
+			if any(d and dirs[i] is not None and (d > 0) != dirs[i] for i, d in enumerate(seg)):
+				yield record()
+				page, dirs = [], [None] * 4
+			for i, d in enumerate(seg):
+				if d: dirs[i] = d > 0
+		page.append(seg)
+		if len(page) == count:
+			yield record()
+			page, dirs = [], [None] * 4
+	if page: yield record()
+
+def main():
+	parser = argparse.ArgumentParser(description='Convert G-code to a Marlin direct stepping job')
+	parser.add_argument('input')
+	parser.add_argument('output')
+	parser.add_argument('--format', choices=sorted(FORMATS), default='SP_4x2_256', help='STEPPER_PAGE_FORMAT')
+	parser.add_argument('--rate', type=int, default=40000, help='Page step rate (steps/s)')
+	parser.add_argument('--kinematics', choices=('cartesian', 'corexy'), default='cartesian')
+	parser.add_argument('--steps', type=axis_list, default=[80, 80, 400, 500], help='Steps/mm X,Y,Z,E')
+	parser.add_argument('--max-feedrate', type=axis_list, default=[300, 300, 5, 25], help='mm/s X,Y,Z,E')
+	parser.add_argument('--max-accel', type=axis_list, default=[3000, 3000, 100, 10000], help='mm/s^2 X,Y,Z,E')
+	parser.add_argument('--accel', type=float, default=1000, help='Print acceleration (mm/s^2)')
+	parser.add_argument('--jerk', type=axis_list, help='Classic jerk X,Y,Z,E (mm/s). Default is junction deviation.')
+	parser.add_argument('--junction-deviation', type=float, default=0.013, help='(mm)')
+	parser.add_argument('--start', type=axis_list, default=[0, 0, 0, 0], help='Position X,Y,Z,E when the job starts')
+	cfg = parser.parse_args()
+
+	fmt = FORMATS[cfg.format]
+	fmt_id, bits, directional, count = fmt
+	seg_steps = (1 << (bits - (1 if directional else 0))) - 1
+
+	with open(cfg.input, 'rt') as f:
+		moves = read_moves(f, cfg)
+	if not moves: sys.exit('No moves in ' + cfg.input)
+	plan(moves, cfg)
+
+	records = list(paginate(sample(moves, cfg, seg_steps), fmt, seg_steps, cfg.rate))
+	stream = heatshrink(b''.join(records))
+
+	header = b'MSTP' + struct.pack('<BBBBHHI', 1, fmt_id, WINDOW_BITS, LOOKAHEAD_BITS, 4 * bits * count // 8, 0, len(records))
+	with open(cfg.output, 'wb') as f:
+		f.write(header + stream)
+
+	raw = sum(len(r) for r in records)
+	print('%d pages, %.1f s, %d bytes (%d uncompressed)' % (len(records), sum(m.duration for m in moves), len(header) + len(stream), raw))
+
+if __name__ == '__main__':
+	main()